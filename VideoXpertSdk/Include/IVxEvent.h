@@ -42,6 +42,14 @@ namespace VxSdk {
         /// <returns>The <see cref="VxResult::Value">Result</see> of the request.</returns>
         virtual VxResult::Value GetSourceDevice(IVxDevice*& device) const = 0;
         /// <summary>
+        /// Gets the <see cref="time"/> at which the situation occurred in milliseconds since the Unix epoch (UTC).
+        /// </summary>
+        /// <returns>The time in milliseconds, or 0 if it is not set.</returns>
+        long long GetTimeMs() const {
+            long long milliseconds = 0;
+            return Utilities::ParseIsoTime(this->time, milliseconds) ? milliseconds : 0;
+        }
+        /// <summary>
         /// Gets the user that was the cause of the situation.
         /// </summary>
         /// <param name="user">The user that caused the situation.</param>
@@ -178,6 +186,7 @@ namespace VxSdk {
     };
 
     typedef void(*VxEventCallback)(IVxEvent*);
+    typedef void(*VxEventContextCallback)(IVxEvent*, void* userData);
 }
 
 #endif // IVxEvent_h__
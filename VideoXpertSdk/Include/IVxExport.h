@@ -25,6 +25,14 @@ namespace VxSdk {
         /// <returns>The <see cref="VxResult::Value">Result</see> of deleting the export.</returns>
         virtual VxResult::Value DeleteExport() const = 0;
         /// <summary>
+        /// Gets the <see cref="completedTime"/> of the export in milliseconds since the Unix epoch (UTC).
+        /// </summary>
+        /// <returns>The time in milliseconds, or 0 if the export has not completed.</returns>
+        long long GetCompletedTimeMs() const {
+            long long milliseconds = 0;
+            return Utilities::ParseIsoTime(this->completedTime, milliseconds) ? milliseconds : 0;
+        }
+        /// <summary>
         /// Gets the <see cref="IVxExportStream"/> for this export.
         /// </summary>
         /// <param name="exportStream">The <see cref="IVxExportStream"/> for this export.</param>
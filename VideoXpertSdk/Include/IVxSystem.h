@@ -16,6 +16,7 @@
 #include "IVxSituation.h"
 #include "IVxTag.h"
 #include "IVxTimeTable.h"
+#include "VxCallbackContext.h"
 #include "VxCollection.h"
 #include "VxNewBookmark.h"
 #include "VxNewDataObject.h"
@@ -616,6 +617,22 @@ namespace VxSdk {
         /// <returns>The <see cref="VxResult::Value">Result</see> of the request.</returns>
         virtual VxResult::Value StartInternalNotifications(VxInternalEventCallback callback) const = 0;
         /// <summary>
+        /// Start receiving internal event notifications sent by the VxSDK, passing a context pointer back with each
+        /// event. The context remains bound to this system until <see cref="StopContextInternalNotifications"/> is
+        /// called, or until it is replaced by another call to this method.
+        /// </summary>
+        /// <param name="callback">The callback to be used when an internal event is received.</param>
+        /// <param name="userData">The context to pass to <paramref name="callback"/>.</param>
+        /// <returns>The <see cref="VxResult::Value">Result</see> of the request.</returns>
+        VxResult::Value StartInternalNotifications(VxInternalEventContextCallback callback, void* userData) const {
+            VxInternalEventCallback internalEventCallback =
+                VxCallbackContext<VxInternalEvent>::Bind(this, callback, userData);
+            if (internalEventCallback == nullptr)
+                return VxResult::kInsufficientResources;
+
+            return StartInternalNotifications(internalEventCallback);
+        }
+        /// <summary>
         /// Start receiving event notifications using the settings for the current user.
         /// </summary>
         /// <param name="callback">The callback to be used when an event is received.</param>
@@ -630,6 +647,63 @@ namespace VxSdk {
         /// <returns>The <see cref="VxResult::Value">Result</see> of the request.</returns>
         virtual VxResult::Value StartNotifications(VxEventCallback callback, VxCollection<IVxSituation**>& situationCollection, bool userNotification = false) const = 0;
         /// <summary>
+        /// Start receiving event notifications using the settings for the current user, passing a context pointer
+        /// back with each event. The context remains bound to this system until <see cref="StopContextNotifications"/>
+        /// is called, or until it is replaced by another call to a context-carrying <c>StartNotifications</c>
+        /// overload.
+        /// </summary>
+        /// <param name="callback">The callback to be used when an event is received.</param>
+        /// <param name="userData">The context to pass to <paramref name="callback"/>.</param>
+        /// <returns>The <see cref="VxResult::Value">Result</see> of the request.</returns>
+        VxResult::Value StartNotifications(VxEventContextCallback callback, void* userData) const {
+            VxEventCallback eventCallback = VxCallbackContext<IVxEvent>::Bind(this, callback, userData);
+            if (eventCallback == nullptr)
+                return VxResult::kInsufficientResources;
+
+            return StartNotifications(eventCallback);
+        }
+        /// <summary>
+        /// Start receiving event notifications by situation type, regardless of user settings, passing a context
+        /// pointer back with each event. The context remains bound to this system until
+        /// <see cref="StopContextNotifications"/> is called, or until it is replaced by another call to a
+        /// context-carrying <c>StartNotifications</c> overload.
+        /// </summary>
+        /// <param name="callback">The callback to be used when an event is received.</param>
+        /// <param name="userData">The context to pass to <paramref name="callback"/>.</param>
+        /// <param name="situationCollection">The situations to subscribe to.</param>
+        /// <param name="userNotification"><c>true</c> to receive user role notifications, otherwise <c>false</c>.</param>
+        /// <returns>The <see cref="VxResult::Value">Result</see> of the request.</returns>
+        VxResult::Value StartNotifications(VxEventContextCallback callback, void* userData,
+            VxCollection<IVxSituation**>& situationCollection, bool userNotification = false) const {
+            VxEventCallback eventCallback = VxCallbackContext<IVxEvent>::Bind(this, callback, userData);
+            if (eventCallback == nullptr)
+                return VxResult::kInsufficientResources;
+
+            return StartNotifications(eventCallback, situationCollection, userNotification);
+        }
+        /// <summary>
+        /// Stop receiving all internal event notifications and release the context bound by the context-carrying
+        /// <see cref="StartInternalNotifications"/> overload. Bindings are a limited, process-wide resource, so this
+        /// must be called before the system is deleted.
+        /// </summary>
+        /// <returns>The <see cref="VxResult::Value">Result</see> of the request.</returns>
+        VxResult::Value StopContextInternalNotifications() const {
+            VxResult::Value result = StopInternalNotifications();
+            VxCallbackContext<VxInternalEvent>::Unbind(this);
+            return result;
+        }
+        /// <summary>
+        /// Stop receiving all event notifications and release the context bound by a context-carrying
+        /// <see cref="StartNotifications"/> overload. Bindings are a limited, process-wide resource, so this must be
+        /// called before the system is deleted.
+        /// </summary>
+        /// <returns>The <see cref="VxResult::Value">Result</see> of the request.</returns>
+        VxResult::Value StopContextNotifications() const {
+            VxResult::Value result = StopNotifications();
+            VxCallbackContext<IVxEvent>::Unbind(this);
+            return result;
+        }
+        /// <summary>
         /// Stop receiving all internal event notifications.
         /// </summary>
         /// <returns>The <see cref="VxResult::Value">Result</see> of the request.</returns>
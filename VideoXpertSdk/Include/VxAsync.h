@@ -0,0 +1,173 @@
+#ifndef VxAsync_h__
+#define VxAsync_h__
+
+#include "VxPrimitives.h"
+#include "VxUtilities.h"
+#include "VxMacros.h"
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace VxSdk {
+    /// <summary>
+    /// The callback used to report the completion of an asynchronous request.
+    /// </summary>
+    typedef void(*VxAsyncCallback)(VxResult::Value result, void* userData);
+
+    /// <summary>
+    /// Runs SDK requests asynchronously on a fixed pool of worker threads. Any method of any SDK object that returns
+    /// a <see cref="VxResult::Value"/> can be run, either returning a <c>std::future</c> for its result or reporting
+    /// it to a completion callback.
+    /// <para>
+    /// SDK requests block the thread they run on, so at most <c>threadCount</c> requests are in flight at once;
+    /// further requests are queued until a worker becomes available.
+    /// </para>
+    /// <example>
+    /// <code>
+    /// IVxDataSource* dataSource = nullptr;
+    /// std::future&lt;VxResult::Value&gt; result = executor.Call(&amp;device, &amp;IVxDevice::GetDataSource,
+    ///     std::ref(dataSource));
+    /// </code>
+    /// </example>
+    /// </summary>
+    struct VxAsyncExecutor {
+    public:
+        /// <summary>
+        /// Initializes a new instance of the <see cref="VxAsyncExecutor"/> struct.
+        /// </summary>
+        /// <param name="threadCount">The number of worker threads, i.e. the maximum requests in flight at once.</param>
+        explicit VxAsyncExecutor(int threadCount = 16) {
+            this->exiting = false;
+            this->activeCount = 0;
+            for (int i = 0; i < (threadCount > 0 ? threadCount : 1); i++)
+                this->workers.push_back(std::thread(&VxAsyncExecutor::Work, this));
+        }
+
+        /// <summary>
+        /// Finalizes an instance of the <see cref="VxAsyncExecutor"/> class. Any queued requests are completed first.
+        /// </summary>
+        ~VxAsyncExecutor() {
+            {
+                std::lock_guard<std::mutex> lock(this->mutex);
+                this->exiting = true;
+            }
+            this->condition.notify_all();
+            for (size_t i = 0; i < this->workers.size(); i++)
+                this->workers[i].join();
+        }
+
+        /// <summary>
+        /// Runs a method of an SDK object asynchronously. Arguments are copied; wrap output arguments in
+        /// <c>std::ref</c> and keep them, and <paramref name="object"/>, alive until the request completes.
+        /// </summary>
+        /// <param name="object">The object to call <paramref name="method"/> on.</param>
+        /// <param name="method">The method to call, e.g. <c>&amp;IVxSystem::GetDevices</c>.</param>
+        /// <param name="args">The arguments to pass to <paramref name="method"/>.</param>
+        /// <returns>A future for the <see cref="VxResult::Value">Result</see> of the request.</returns>
+        template<typename TObject, typename TMethod, typename... TArgs>
+        std::future<VxResult::Value> Call(TObject* object, TMethod method, TArgs&&... args) {
+            return Run(std::bind(method, object, std::forward<TArgs>(args)...));
+        }
+
+        /// <summary>
+        /// Runs a method of an SDK object asynchronously, reporting its result to a completion callback. Arguments
+        /// are copied; wrap output arguments in <c>std::ref</c> and keep them, and <paramref name="object"/>, alive
+        /// until the request completes.
+        /// </summary>
+        /// <param name="callback">The callback to report the result to, on a worker thread.</param>
+        /// <param name="userData">The context to pass to <paramref name="callback"/>.</param>
+        /// <param name="object">The object to call <paramref name="method"/> on.</param>
+        /// <param name="method">The method to call, e.g. <c>&amp;IVxSystem::GetDevices</c>.</param>
+        /// <param name="args">The arguments to pass to <paramref name="method"/>.</param>
+        template<typename TObject, typename TMethod, typename... TArgs>
+        void CallWithCallback(VxAsyncCallback callback, void* userData, TObject* object, TMethod method,
+            TArgs&&... args) {
+            RunWithCallback(callback, userData, std::bind(method, object, std::forward<TArgs>(args)...));
+        }
+
+        /// <summary>
+        /// Gets the number of requests that are queued or in flight.
+        /// </summary>
+        /// <returns>The pending request count.</returns>
+        int GetPendingCount() const {
+            std::lock_guard<std::mutex> lock(this->mutex);
+            return static_cast<int>(this->queue.size()) + this->activeCount;
+        }
+
+        /// <summary>
+        /// Runs a function asynchronously.
+        /// </summary>
+        /// <param name="function">
+        /// A function, taking no arguments, that returns a <see cref="VxResult::Value"/>.
+        /// </param>
+        /// <returns>A future for the <see cref="VxResult::Value">Result</see> of the function.</returns>
+        template<typename TFunction>
+        std::future<VxResult::Value> Run(TFunction function) {
+            std::shared_ptr<std::packaged_task<VxResult::Value()> > task =
+                std::make_shared<std::packaged_task<VxResult::Value()> >(function);
+            std::future<VxResult::Value> result = task->get_future();
+            Enqueue([task]() { (*task)(); });
+            return result;
+        }
+
+        /// <summary>
+        /// Runs a function asynchronously, reporting its result to a completion callback.
+        /// </summary>
+        /// <param name="callback">The callback to report the result to, on a worker thread.</param>
+        /// <param name="userData">The context to pass to <paramref name="callback"/>.</param>
+        /// <param name="function">
+        /// A function, taking no arguments, that returns a <see cref="VxResult::Value"/>.
+        /// </param>
+        template<typename TFunction>
+        void RunWithCallback(VxAsyncCallback callback, void* userData, TFunction function) {
+            Enqueue([callback, userData, function]() mutable {
+                VxResult::Value result = function();
+                if (callback != nullptr)
+                    callback(result, userData);
+            });
+        }
+
+    private:
+        void Enqueue(std::function<void()> work) {
+            // Notify while locked; the work may complete, and the executor be destroyed, as soon as it is unlocked
+            std::lock_guard<std::mutex> lock(this->mutex);
+            this->queue.push_back(std::move(work));
+            this->condition.notify_one();
+        }
+
+        void Work() {
+            std::unique_lock<std::mutex> lock(this->mutex);
+            while (true) {
+                this->condition.wait(lock, [this] { return this->exiting || !this->queue.empty(); });
+                if (this->queue.empty())
+                    return;
+
+                std::function<void()> work = std::move(this->queue.front());
+                this->queue.pop_front();
+                this->activeCount++;
+                lock.unlock();
+                work();
+                lock.lock();
+                this->activeCount--;
+            }
+        }
+
+        bool exiting;
+        int activeCount;
+        std::deque<std::function<void()> > queue;
+        std::vector<std::thread> workers;
+        mutable std::mutex mutex;
+        std::condition_variable condition;
+
+        VxAsyncExecutor(const VxAsyncExecutor&);
+        VxAsyncExecutor& operator=(const VxAsyncExecutor&);
+    };
+}
+
+#endif // VxAsync_h__
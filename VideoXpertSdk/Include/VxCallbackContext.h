@@ -0,0 +1,127 @@
+#ifndef VxCallbackContext_h__
+#define VxCallbackContext_h__
+
+#include "VxPrimitives.h"
+#include "VxUtilities.h"
+#include "VxMacros.h"
+#include <atomic>
+#include <mutex>
+
+namespace VxSdk {
+    namespace Internal {
+        template<typename TContext, int Lo, int Hi, bool Leaf = (Hi - Lo == 1)>
+        struct VxCallbackTrampoline {
+            static typename TContext::Callback Get(int index) {
+                return index < (Lo + Hi) / 2 ?
+                    VxCallbackTrampoline<TContext, Lo, (Lo + Hi) / 2>::Get(index) :
+                    VxCallbackTrampoline<TContext, (Lo + Hi) / 2, Hi>::Get(index);
+            }
+        };
+
+        template<typename TContext, int Lo, int Hi>
+        struct VxCallbackTrampoline<TContext, Lo, Hi, true> {
+            static typename TContext::Callback Get(int) {
+                return &TContext::template Invoke<Lo>;
+            }
+        };
+    }
+
+    /// <summary>
+    /// Binds a context pointer to the plain function pointer callbacks used by the SDK (e.g.
+    /// <see cref="VxEventCallback"/>). Each binding is assigned its own generated callback, so the context is
+    /// passed back without a global lookup or lock on the delivery path.
+    /// <para>
+    /// A binding must not be changed or removed while its callback may still be invoked; stop the notifications
+    /// it was registered for first.
+    /// </para>
+    /// </summary>
+    /// <typeparam name="TArg">The callback argument type, e.g. <see cref="IVxEvent"/>.</typeparam>
+    template<typename TArg>
+    struct VxCallbackContext {
+    public:
+        /// <summary>
+        /// The callback type expected by the SDK.
+        /// </summary>
+        typedef void(*Callback)(TArg*);
+        /// <summary>
+        /// The callback type that receives the bound context.
+        /// </summary>
+        typedef void(*ContextCallback)(TArg*, void*);
+        /// <summary>
+        /// The maximum number of bindings that may exist at once.
+        /// </summary>
+        static const int kMaxSlots = 128;
+
+        /// <summary>
+        /// Binds a callback and its context to an owner, replacing any existing binding for that owner.
+        /// </summary>
+        /// <param name="owner">The object that owns the binding, used to find it again.</param>
+        /// <param name="callback">The callback to invoke.</param>
+        /// <param name="userData">The context to pass to <paramref name="callback"/>.</param>
+        /// <returns>The callback to register with the SDK, or <c>nullptr</c> if all bindings are in use.</returns>
+        static Callback Bind(const void* owner, ContextCallback callback, void* userData) {
+            std::lock_guard<std::mutex> lock(Lock());
+            int index = -1;
+            for (int i = 0; i < kMaxSlots; i++) {
+                const void* slotOwner = slots[i].owner.load(std::memory_order_relaxed);
+                if (slotOwner == owner) {
+                    index = i;
+                    break;
+                }
+
+                if (slotOwner == nullptr && index < 0)
+                    index = i;
+            }
+
+            if (index < 0)
+                return nullptr;
+
+            slots[index].userData.store(userData, std::memory_order_relaxed);
+            slots[index].callback.store(callback, std::memory_order_release);
+            slots[index].owner.store(owner, std::memory_order_relaxed);
+            return Internal::VxCallbackTrampoline<VxCallbackContext, 0, kMaxSlots>::Get(index);
+        }
+
+        /// <summary>
+        /// Removes the binding for an owner, if any.
+        /// </summary>
+        /// <param name="owner">The object that owns the binding.</param>
+        static void Unbind(const void* owner) {
+            std::lock_guard<std::mutex> lock(Lock());
+            for (int i = 0; i < kMaxSlots; i++) {
+                if (slots[i].owner.load(std::memory_order_relaxed) != owner)
+                    continue;
+
+                slots[i].callback.store(nullptr, std::memory_order_release);
+                slots[i].userData.store(nullptr, std::memory_order_relaxed);
+                slots[i].owner.store(nullptr, std::memory_order_relaxed);
+            }
+        }
+
+        template<int N>
+        static void Invoke(TArg* arg) {
+            ContextCallback callback = slots[N].callback.load(std::memory_order_acquire);
+            if (callback != nullptr)
+                callback(arg, slots[N].userData.load(std::memory_order_relaxed));
+        }
+
+    private:
+        struct Slot {
+            std::atomic<const void*> owner;
+            std::atomic<ContextCallback> callback;
+            std::atomic<void*> userData;
+        };
+
+        static std::mutex& Lock() {
+            static std::mutex lock;
+            return lock;
+        }
+
+        static Slot slots[kMaxSlots];
+    };
+
+    template<typename TArg>
+    typename VxCallbackContext<TArg>::Slot VxCallbackContext<TArg>::slots[VxCallbackContext<TArg>::kMaxSlots];
+}
+
+#endif // VxCallbackContext_h__
@@ -57,6 +57,24 @@ namespace VxSdk {
             this->filters = nullptr;
         }
 
+        /// <summary>
+        /// Deletes each item in <see cref="collection"/> followed by the collection array itself, releasing the
+        /// entire result of a request in a single call. The filters are left untouched.
+        /// <para>
+        /// Only applicable to collections of SDK allocated items, such as <c>VxCollection&lt;IVxDevice**&gt;</c>.
+        /// </para>
+        /// </summary>
+        void Release() {
+            for (int i = 0; i < this->collectionSize; i++) {
+                if (this->collection[i] != nullptr)
+                    this->collection[i]->Delete();
+            }
+
+            delete[] this->collection;
+            this->collection = T();
+            this->collectionSize = 0;
+        }
+
     public:
         /// <summary>
         /// The size of <see cref="collection"/>.
@@ -83,6 +101,50 @@ namespace VxSdk {
         /// </summary>
         VxCollectionFilter* filters;
     };
+
+    /// <summary>
+    /// Gets the total amount of items a <see cref="VxCollection{T}"/> request would return without retrieving or
+    /// building any of the items themselves.
+    /// </summary>
+    /// <param name="source">The object to make the request on, e.g. an <see cref="IVxSystem"/>.</param>
+    /// <param name="request">The collection request to make, e.g. <c>&amp;IVxSystem::GetEvents</c>.</param>
+    /// <param name="count">The total amount of items matching <paramref name="filters"/>.</param>
+    /// <param name="filters">The filters to apply to the request; any paging filters are ignored.</param>
+    /// <param name="filterSize">The size of <paramref name="filters"/>.</param>
+    /// <returns>
+    /// The <see cref="VxResult::Value">Result</see> of the request; <see cref="VxResult::kActionUnavailable"/> if
+    /// the response did not report a total, in which case <paramref name="count"/> is left unchanged.
+    /// </returns>
+    template<typename TItem, typename TSource>
+    VxResult::Value VxGetCollectionCount(const TSource& source,
+        VxResult::Value(TSource::*request)(VxCollection<TItem**>&) const, int& count,
+        VxCollectionFilter* filters = nullptr, int filterSize = 0) {
+        // Limit the response to a single item; only the total is read from it
+        VxCollection<TItem**> collection;
+        collection.filters = new VxCollectionFilter[filterSize + 1];
+        for (int i = 0; i < filterSize; i++) {
+            if (filters[i].key == VxCollectionFilterItem::kStart || filters[i].key == VxCollectionFilterItem::kCount)
+                continue;
+            collection.filters[collection.filterSize++] = VxCollectionFilter(filters[i]);
+        }
+        collection.filters[collection.filterSize].key = VxCollectionFilterItem::kCount;
+        Utilities::StrCopySafe(collection.filters[collection.filterSize].value, "1");
+        collection.filterSize++;
+
+        // Without a collection to fill the request only reports the sizes
+        VxCollectionFilter* requestFilters = collection.filters;
+        VxResult::Value result = (source.*request)(collection);
+        delete[] requestFilters;
+        if (result != VxResult::kOK && result != VxResult::kInsufficientSize)
+            return result;
+
+        // A non-empty response without a total does not say how many items there are
+        if (collection.totalItems <= 0 && collection.collectionSize > 0)
+            return VxResult::kActionUnavailable;
+
+        count = collection.totalItems;
+        return VxResult::kOK;
+    }
 }
 
 #endif // VxCollection_h__
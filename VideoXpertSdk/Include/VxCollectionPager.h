@@ -0,0 +1,336 @@
+#ifndef VxCollectionPager_h__
+#define VxCollectionPager_h__
+
+#include "VxPrimitives.h"
+#include "VxUtilities.h"
+#include "VxMacros.h"
+#include "VxCollection.h"
+#include "VxCollectionFilter.h"
+#include <condition_variable>
+#include <cstdio>
+#include <mutex>
+#include <thread>
+
+namespace VxSdk {
+    /// <summary>
+    /// Iterates over the results of a <see cref="VxCollection{T}"/> request one page at a time using the
+    /// <see cref="VxCollectionFilterItem::kStart"/> and <see cref="VxCollectionFilterItem::kCount"/> filters. While
+    /// the current page is being processed the next page is retrieved on a worker thread owned by the pager, so peak
+    /// memory depends on the page size rather than the total number of items. If a page is too large to be returned
+    /// (<see cref="VxResult::kResponseTooLarge"/>), the page size is halved until it can be.
+    /// <para>
+    /// Items are owned by the pager and are only valid until it moves past the page that contains them.
+    /// </para>
+    /// </summary>
+    /// <typeparam name="TItem">The item type, e.g. <see cref="IVxDataSource"/>.</typeparam>
+    /// <typeparam name="TSource">The type making the request, e.g. <see cref="IVxSystem"/>.</typeparam>
+    template<typename TItem, typename TSource>
+    struct VxCollectionPager {
+    public:
+        /// <summary>
+        /// A method that fills a <see cref="VxCollection{T}"/>, e.g. <c>&amp;IVxSystem::GetDataSources</c>.
+        /// </summary>
+        typedef VxResult::Value(TSource::*Request)(VxCollection<TItem**>&) const;
+
+        /// <summary>
+        /// A forward iterator over the items returned by a <see cref="VxCollectionPager{TItem, TSource}"/>.
+        /// </summary>
+        struct Iterator {
+        public:
+            /// <summary>
+            /// Initializes a new instance of the <see cref="Iterator"/> struct.
+            /// </summary>
+            /// <param name="pager">The pager to iterate, or <c>nullptr</c> for the end iterator.</param>
+            explicit Iterator(VxCollectionPager* pager = nullptr) {
+                this->pager = pager;
+            }
+
+            TItem* operator*() const {
+                return this->pager->Current();
+            }
+
+            Iterator& operator++() {
+                if (!this->pager->MoveNext())
+                    this->pager = nullptr;
+                return *this;
+            }
+
+            bool operator==(const Iterator& other) const {
+                return this->pager == other.pager;
+            }
+
+            bool operator!=(const Iterator& other) const {
+                return this->pager != other.pager;
+            }
+
+        private:
+            VxCollectionPager* pager;
+        };
+
+        /// <summary>
+        /// Initializes a new instance of the <see cref="VxCollectionPager{TItem, TSource}"/> struct.
+        /// </summary>
+        /// <param name="source">The object to make the request on.</param>
+        /// <param name="request">The collection request to make.</param>
+        /// <param name="filters">The filters to apply to each page request; any paging filters are ignored.</param>
+        /// <param name="filterSize">The size of <paramref name="filters"/>.</param>
+        /// <param name="pageSize">The initial maximum number of items to retrieve per page.</param>
+        /// <param name="prefetch"><c>true</c> to retrieve the next page in the background, otherwise <c>false</c>.</param>
+        VxCollectionPager(const TSource& source, Request request, VxCollectionFilter* filters = nullptr,
+            int filterSize = 0, int pageSize = 100, bool prefetch = true) {
+            this->source = &source;
+            this->request = request;
+            this->pageSize = pageSize > 0 ? pageSize : 100;
+            this->prefetch = prefetch;
+            this->started = false;
+            this->hasMore = true;
+            this->nextStart = 0;
+            this->index = 0;
+            this->result = VxResult::kOK;
+            this->totalItems = 0;
+            this->exiting = false;
+            this->prefetchRequested = false;
+            this->prefetchReady = false;
+            this->prefetchStart = 0;
+
+            // Reserve the last two filters for the paging values
+            this->filterSize = 0;
+            this->filters = new VxCollectionFilter[filterSize + 2];
+            for (int i = 0; i < filterSize; i++) {
+                VxCollectionFilterItem::Value key = filters[i].key;
+                if (key == VxCollectionFilterItem::kStart || key == VxCollectionFilterItem::kCount)
+                    continue;
+                this->filters[this->filterSize++] = VxCollectionFilter(filters[i]);
+            }
+            this->filters[this->filterSize].key = VxCollectionFilterItem::kStart;
+            this->filters[this->filterSize + 1].key = VxCollectionFilterItem::kCount;
+            snprintf(this->filters[this->filterSize + 1].value, sizeof(this->filters[0].value), "%d", this->pageSize);
+            this->filterSize += 2;
+        }
+
+        /// <summary>
+        /// Finalizes an instance of the <see cref="VxCollectionPager{TItem, TSource}"/> class.
+        /// </summary>
+        ~VxCollectionPager() {
+            if (this->worker.joinable()) {
+                {
+                    std::lock_guard<std::mutex> lock(this->mutex);
+                    this->exiting = true;
+                }
+                this->condition.notify_all();
+                this->worker.join();
+            }
+
+            if (this->prefetchReady)
+                this->prefetched.Delete();
+            this->page.Delete();
+            delete[] this->filters;
+        }
+
+        /// <summary>
+        /// Retrieves the first page, if needed, and returns an iterator to the current item.
+        /// </summary>
+        /// <returns>An iterator to the current item, or the end iterator if there are no items.</returns>
+        Iterator begin() {
+            if (!this->started && !MoveNext())
+                return end();
+            return Iterator(this->index < this->page.size ? this : nullptr);
+        }
+
+        /// <summary>
+        /// Returns the end iterator.
+        /// </summary>
+        /// <returns>The end iterator.</returns>
+        Iterator end() {
+            return Iterator();
+        }
+
+        /// <summary>
+        /// Gets the current item.
+        /// </summary>
+        /// <returns>The current item, or <c>nullptr</c> if there is no current item.</returns>
+        TItem* Current() const {
+            return this->index < this->page.size ? this->page.items[this->index] : nullptr;
+        }
+
+        /// <summary>
+        /// Advances to the next item, retrieving the next page if the current one has been exhausted.
+        /// </summary>
+        /// <returns><c>true</c> if there is a current item, <c>false</c> once all items have been returned or a
+        /// request has failed (see <see cref="result"/>).</returns>
+        bool MoveNext() {
+            if (this->started && ++this->index < this->page.size)
+                return true;
+
+            this->started = true;
+            while (this->hasMore) {
+                Page next;
+                if (!TakePrefetched(next))
+                    next = Fetch(this->nextStart);
+
+                this->page.Delete();
+                this->page = next;
+                this->index = 0;
+                this->result = next.result;
+                if (next.result != VxResult::kOK) {
+                    this->hasMore = false;
+                    return false;
+                }
+
+                this->totalItems = next.totalItems;
+                this->nextStart += next.size;
+                this->hasMore = next.size > 0 &&
+                    (next.totalItems > 0 ? this->nextStart < next.totalItems : next.size >= this->pageSize);
+                if (this->hasMore && this->prefetch)
+                    Prefetch(this->nextStart);
+
+                if (next.size > 0)
+                    return true;
+            }
+
+            return false;
+        }
+
+    public:
+        /// <summary>
+        /// The result of the most recent page request.
+        /// </summary>
+        VxResult::Value result;
+        /// <summary>
+        /// The total amount of items, as reported by the most recent page request.
+        /// </summary>
+        int totalItems;
+
+    private:
+        VxCollectionPager(const VxCollectionPager&);
+        VxCollectionPager& operator=(const VxCollectionPager&);
+
+        struct Page {
+            Page() {
+                this->items = nullptr;
+                this->size = 0;
+                this->totalItems = 0;
+                this->result = VxResult::kOK;
+            }
+
+            void Delete() {
+                for (int i = 0; i < this->size; i++) {
+                    if (this->items[i] != nullptr)
+                        this->items[i]->Delete();
+                }
+                delete[] this->items;
+                this->items = nullptr;
+                this->size = 0;
+            }
+
+            TItem** items;
+            int size;
+            int totalItems;
+            VxResult::Value result;
+        };
+
+        void Prefetch(int start) {
+            // The worker is started on first use and serves every page until the pager is destroyed
+            if (!this->worker.joinable())
+                this->worker = std::thread(&VxCollectionPager::Work, this);
+
+            std::lock_guard<std::mutex> lock(this->mutex);
+            this->prefetchStart = start;
+            this->prefetchRequested = true;
+            this->prefetchReady = false;
+            this->condition.notify_all();
+        }
+
+        bool TakePrefetched(Page& next) {
+            std::unique_lock<std::mutex> lock(this->mutex);
+            if (!this->prefetchRequested)
+                return false;
+
+            this->condition.wait(lock, [this] { return this->prefetchReady; });
+            next = this->prefetched;
+            this->prefetched = Page();
+            this->prefetchRequested = false;
+            this->prefetchReady = false;
+            return true;
+        }
+
+        void Work() {
+            std::unique_lock<std::mutex> lock(this->mutex);
+            while (true) {
+                this->condition.wait(lock, [this] {
+                    return this->exiting || (this->prefetchRequested && !this->prefetchReady);
+                });
+                if (this->exiting)
+                    return;
+
+                int start = this->prefetchStart;
+                lock.unlock();
+                Page next = Fetch(start);
+                lock.lock();
+                this->prefetched = next;
+                this->prefetchReady = true;
+                this->condition.notify_all();
+            }
+        }
+
+        Page Fetch(int start) {
+            // Only one request is ever in flight, so the shared filters can be updated here
+            snprintf(this->filters[this->filterSize - 2].value, sizeof(this->filters[0].value), "%d", start);
+
+            Page page;
+            while (true) {
+                VxCollection<TItem**> collection;
+                collection.filters = this->filters;
+                collection.filterSize = this->filterSize;
+                collection.collectionSize = this->pageSize;
+                collection.collection = new TItem*[this->pageSize];
+
+                page.result = (this->source->*this->request)(collection);
+                if (page.result == VxResult::kInsufficientSize) {
+                    // The request did not honor the page size; allocate what it asked for and try again
+                    delete[] collection.collection;
+                    collection.collection = new TItem*[collection.collectionSize];
+                    page.result = (this->source->*this->request)(collection);
+                }
+
+                if (page.result == VxResult::kOK) {
+                    page.items = collection.collection;
+                    page.size = collection.collectionSize;
+                    page.totalItems = collection.totalItems;
+                    return page;
+                }
+
+                delete[] collection.collection;
+                if (page.result != VxResult::kResponseTooLarge || this->pageSize == 1)
+                    return page;
+
+                // Retry this and every following page with half as many items
+                this->pageSize = (this->pageSize + 1) / 2;
+                snprintf(this->filters[this->filterSize - 1].value, sizeof(this->filters[0].value), "%d",
+                    this->pageSize);
+            }
+        }
+
+        const TSource* source;
+        Request request;
+        VxCollectionFilter* filters;
+        int filterSize;
+        int pageSize;
+        bool prefetch;
+        bool started;
+        bool hasMore;
+        int nextStart;
+        int index;
+        Page page;
+        bool exiting;
+        bool prefetchRequested;
+        bool prefetchReady;
+        int prefetchStart;
+        Page prefetched;
+        std::thread worker;
+        std::mutex mutex;
+        std::condition_variable condition;
+    };
+}
+
+#endif // VxCollectionPager_h__
@@ -0,0 +1,87 @@
+#ifndef VxCompactBookmark_h__
+#define VxCompactBookmark_h__
+
+#include "VxPrimitives.h"
+#include "VxUtilities.h"
+#include "VxMacros.h"
+#include "IVxBookmark.h"
+#include "VxCompactString.h"
+#include "VxStringPool.h"
+
+namespace VxSdk {
+    /// <summary>
+    /// Represents a compact copy of the fields of an <see cref="IVxBookmark"/>. Identifiers that repeat across
+    /// bookmarks are interned in a <see cref="VxStringPool"/>.
+    /// </summary>
+    struct VxCompactBookmark {
+    public:
+        /// <summary>
+        /// Initializes a new instance of the <see cref="VxCompactBookmark"/> struct.
+        /// </summary>
+        VxCompactBookmark() {
+            Clear();
+        }
+
+        /// <summary>
+        /// Initializes a new instance of the <see cref="VxCompactBookmark"/> struct.
+        /// </summary>
+        /// <param name="bookmark">The bookmark to copy.</param>
+        /// <param name="pool">The pool that will own the interned strings.</param>
+        VxCompactBookmark(const IVxBookmark& bookmark, VxStringPool& pool) {
+            this->dataSourceId = pool.Intern(bookmark.dataSourceId);
+            this->description.Set(bookmark.description, pool);
+            this->groupId = pool.Intern(bookmark.groupId);
+            this->id.Set(bookmark.id, pool);
+            this->name.Set(bookmark.name, pool);
+            this->time.Set(bookmark.time, pool);
+            this->timeMs = 0;
+            Utilities::ParseIsoTime(bookmark.time, this->timeMs);
+        }
+
+        /// <summary>
+        /// Clears this instance.
+        /// </summary>
+        void Clear() {
+            this->dataSourceId = "";
+            this->description.Clear();
+            this->groupId = "";
+            this->id.Clear();
+            this->name.Clear();
+            this->time.Clear();
+            this->timeMs = 0;
+        }
+
+    public:
+        /// <summary>
+        /// The unique identifier of the associated data source.
+        /// </summary>
+        const char* dataSourceId;
+        /// <summary>
+        /// The friendly description of the bookmark.
+        /// </summary>
+        VxCompactString description;
+        /// <summary>
+        /// The unique identifier of the associated bookmark group (if any).
+        /// </summary>
+        const char* groupId;
+        /// <summary>
+        /// The unique identifier of the bookmark.
+        /// </summary>
+        VxCompactString id;
+        /// <summary>
+        /// The friendly name of the bookmark.
+        /// </summary>
+        VxCompactString name;
+        /// <summary>
+        /// The time at which the point of interest occurred.
+        /// </summary>
+        VxCompactString time;
+        /// <summary>
+        /// The time at which the point of interest occurred, in milliseconds since the Unix epoch (UTC), or 0 if it
+        /// could not be parsed.
+        /// </summary>
+        long long timeMs;
+    };
+}
+
+#endif // VxCompactBookmark_h__
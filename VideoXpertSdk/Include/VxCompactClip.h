@@ -0,0 +1,111 @@
+#ifndef VxCompactClip_h__
+#define VxCompactClip_h__
+
+#include "VxPrimitives.h"
+#include "VxUtilities.h"
+#include "VxMacros.h"
+#include "IVxClip.h"
+#include "VxCompactString.h"
+#include "VxStringPool.h"
+
+namespace VxSdk {
+    /// <summary>
+    /// Represents a compact copy of the metadata of an <see cref="IVxClip"/>. Identifiers that repeat across clips
+    /// are interned in a <see cref="VxStringPool"/>; the data interfaces are not retained.
+    /// </summary>
+    struct VxCompactClip {
+    public:
+        /// <summary>
+        /// Initializes a new instance of the <see cref="VxCompactClip"/> struct.
+        /// </summary>
+        VxCompactClip() {
+            Clear();
+        }
+
+        /// <summary>
+        /// Initializes a new instance of the <see cref="VxCompactClip"/> struct.
+        /// </summary>
+        /// <param name="clip">The clip to copy.</param>
+        /// <param name="pool">The pool that will own the interned strings.</param>
+        VxCompactClip(const IVxClip& clip, VxStringPool& pool) {
+            this->dataSourceId = pool.Intern(clip.dataSourceId);
+            this->dataSourceName = pool.Intern(clip.dataSourceName);
+            this->dataStorageId = pool.Intern(clip.dataStorageId);
+            this->endTime.Set(clip.endTime, pool);
+            this->sourceDataStorageId = pool.Intern(clip.sourceDataStorageId);
+            this->startTime.Set(clip.startTime, pool);
+            this->type = pool.Intern(clip.type);
+            this->framerate = clip.framerate;
+            this->recordingType = clip.recordingType;
+            this->endTimeMs = 0;
+            this->startTimeMs = 0;
+            Utilities::ParseIsoTime(clip.endTime, this->endTimeMs);
+            Utilities::ParseIsoTime(clip.startTime, this->startTimeMs);
+        }
+
+        /// <summary>
+        /// Clears this instance.
+        /// </summary>
+        void Clear() {
+            this->dataSourceId = "";
+            this->dataSourceName = "";
+            this->dataStorageId = "";
+            this->endTime.Clear();
+            this->sourceDataStorageId = "";
+            this->startTime.Clear();
+            this->type = "";
+            this->framerate = VxRecordingFramerate::kUnknown;
+            this->recordingType = VxRecordingType::kUnknown;
+            this->endTimeMs = 0;
+            this->startTimeMs = 0;
+        }
+
+    public:
+        /// <summary>
+        /// The unique identifier of the clips data source.
+        /// </summary>
+        const char* dataSourceId;
+        /// <summary>
+        /// The friendly name of the clips data source.
+        /// </summary>
+        const char* dataSourceName;
+        /// <summary>
+        /// The unique identifier of the data storage on which the media for this clip is stored.
+        /// </summary>
+        const char* dataStorageId;
+        /// <summary>
+        /// The end time of the clip.
+        /// </summary>
+        VxCompactString endTime;
+        /// <summary>
+        /// The unique identifier of the data storage on which the media for this clip was originally stored.
+        /// </summary>
+        const char* sourceDataStorageId;
+        /// <summary>
+        /// The start time of the clip.
+        /// </summary>
+        VxCompactString startTime;
+        /// <summary>
+        /// The type of media contained in the clip.
+        /// </summary>
+        const char* type;
+        /// <summary>
+        /// The end time of the clip, in milliseconds since the Unix epoch (UTC), or 0 if it could not be parsed.
+        /// </summary>
+        long long endTimeMs;
+        /// <summary>
+        /// The start time of the clip, in milliseconds since the Unix epoch (UTC), or 0 if it could not be parsed.
+        /// </summary>
+        long long startTimeMs;
+        /// <summary>
+        /// The framerate of the clip.
+        /// </summary>
+        VxRecordingFramerate::Value framerate;
+        /// <summary>
+        /// The event type that triggered the recording of the clip.
+        /// </summary>
+        VxRecordingType::Value recordingType;
+    };
+}
+
+#endif // VxCompactClip_h__
@@ -0,0 +1,82 @@
+#ifndef VxCompactCollection_h__
+#define VxCompactCollection_h__
+
+#include "VxPrimitives.h"
+#include "VxUtilities.h"
+#include "VxMacros.h"
+#include "VxCollection.h"
+#include "VxStringPool.h"
+#include <vector>
+
+namespace VxSdk {
+    /// <summary>
+    /// Holds compact copies of collection items (e.g. <see cref="VxCompactClip"/>) along with the
+    /// <see cref="VxStringPool"/> that owns their interned strings. Intended for keeping large timeline query results
+    /// resident after the original items have been deleted.
+    /// </summary>
+    /// <typeparam name="TCompact">The compact item type, e.g. <see cref="VxCompactClip"/>.</typeparam>
+    template<typename TCompact>
+    struct VxCompactCollection {
+    public:
+        /// <summary>
+        /// Initializes a new instance of the <see cref="VxCompactCollection{TCompact}"/> struct.
+        /// </summary>
+        VxCompactCollection() {
+            Clear();
+        }
+
+        /// <summary>
+        /// Finalizes an instance of the <see cref="VxCompactCollection{TCompact}"/> class.
+        /// </summary>
+        ~VxCompactCollection() {
+            Clear();
+        }
+
+        /// <summary>
+        /// Clears this instance.
+        /// </summary>
+        void Clear() {
+            this->items.clear();
+            this->pool.Clear();
+        }
+
+        /// <summary>
+        /// Adds a compact copy of an item.
+        /// </summary>
+        /// <param name="item">The item to copy, e.g. an <see cref="IVxClip"/>.</param>
+        template<typename TItem>
+        void Add(const TItem& item) {
+            this->items.push_back(TCompact(item, this->pool));
+        }
+
+        /// <summary>
+        /// Adds compact copies of all items in a collection, then deletes the original items and the collection
+        /// array.
+        /// </summary>
+        /// <param name="collection">The collection to take the items from.</param>
+        template<typename TItem>
+        void Append(VxCollection<TItem**>& collection) {
+            this->items.reserve(this->items.size() + collection.collectionSize);
+            for (int i = 0; i < collection.collectionSize; i++) {
+                if (collection.collection[i] != nullptr)
+                    Add(*collection.collection[i]);
+            }
+
+            collection.Release();
+        }
+
+    public:
+        /// <summary>
+        /// The compact items; only valid for the lifetime of this collection.
+        /// </summary>
+        std::vector<TCompact> items;
+
+    private:
+        VxCompactCollection(const VxCompactCollection&);
+        VxCompactCollection& operator=(const VxCompactCollection&);
+
+        VxStringPool pool;
+    };
+}
+
+#endif // VxCompactCollection_h__
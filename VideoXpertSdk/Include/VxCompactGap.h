@@ -0,0 +1,93 @@
+#ifndef VxCompactGap_h__
+#define VxCompactGap_h__
+
+#include "VxPrimitives.h"
+#include "VxUtilities.h"
+#include "VxMacros.h"
+#include "IVxGap.h"
+#include "VxCompactString.h"
+#include "VxStringPool.h"
+
+namespace VxSdk {
+    /// <summary>
+    /// Represents a compact copy of the metadata of an <see cref="IVxGap"/>. Identifiers that repeat across gaps
+    /// are interned in a <see cref="VxStringPool"/>; the reason data is not retained.
+    /// </summary>
+    struct VxCompactGap {
+    public:
+        /// <summary>
+        /// Initializes a new instance of the <see cref="VxCompactGap"/> struct.
+        /// </summary>
+        VxCompactGap() {
+            Clear();
+        }
+
+        /// <summary>
+        /// Initializes a new instance of the <see cref="VxCompactGap"/> struct.
+        /// </summary>
+        /// <param name="gap">The gap to copy.</param>
+        /// <param name="pool">The pool that will own the interned strings.</param>
+        VxCompactGap(const IVxGap& gap, VxStringPool& pool) {
+            this->dataSourceId = pool.Intern(gap.dataSourceId);
+            this->dataStorageId = pool.Intern(gap.dataStorageId);
+            this->endTime.Set(gap.endTime, pool);
+            this->startTime.Set(gap.startTime, pool);
+            this->gapFillerStatus = gap.gapFillerStatus;
+            this->reason = gap.reason;
+            this->endTimeMs = 0;
+            this->startTimeMs = 0;
+            Utilities::ParseIsoTime(gap.endTime, this->endTimeMs);
+            Utilities::ParseIsoTime(gap.startTime, this->startTimeMs);
+        }
+
+        /// <summary>
+        /// Clears this instance.
+        /// </summary>
+        void Clear() {
+            this->dataSourceId = "";
+            this->dataStorageId = "";
+            this->endTime.Clear();
+            this->startTime.Clear();
+            this->gapFillerStatus = VxGapFillerStatus::kUnknown;
+            this->reason = VxGapReason::kUnknown;
+            this->endTimeMs = 0;
+            this->startTimeMs = 0;
+        }
+
+    public:
+        /// <summary>
+        /// The unique identifier of the gapped data source.
+        /// </summary>
+        const char* dataSourceId;
+        /// <summary>
+        /// The unique identifier of the data storage with the gap.
+        /// </summary>
+        const char* dataStorageId;
+        /// <summary>
+        /// The end time of the gap.
+        /// </summary>
+        VxCompactString endTime;
+        /// <summary>
+        /// The start time of the gap.
+        /// </summary>
+        VxCompactString startTime;
+        /// <summary>
+        /// The end time of the gap, in milliseconds since the Unix epoch (UTC), or 0 if it could not be parsed.
+        /// </summary>
+        long long endTimeMs;
+        /// <summary>
+        /// The start time of the gap, in milliseconds since the Unix epoch (UTC), or 0 if it could not be parsed.
+        /// </summary>
+        long long startTimeMs;
+        /// <summary>
+        /// The status of filling this gap.
+        /// </summary>
+        VxGapFillerStatus::Value gapFillerStatus;
+        /// <summary>
+        /// The reason for this gap.
+        /// </summary>
+        VxGapReason::Value reason;
+    };
+}
+
+#endif // VxCompactGap_h__
@@ -0,0 +1,79 @@
+#ifndef VxCompactString_h__
+#define VxCompactString_h__
+
+#include "VxPrimitives.h"
+#include "VxUtilities.h"
+#include "VxMacros.h"
+#include "VxStringPool.h"
+
+namespace VxSdk {
+    /// <summary>
+    /// Represents a string that is stored inline when short (e.g. a UUID or timestamp) and interned in a
+    /// <see cref="VxStringPool"/> otherwise.
+    /// </summary>
+    struct VxCompactString {
+    public:
+        /// <summary>
+        /// The maximum length, including the terminator, of a string that is stored inline.
+        /// </summary>
+        static const int kInlineLength = 40;
+
+        /// <summary>
+        /// Initializes a new instance of the <see cref="VxCompactString"/> struct.
+        /// </summary>
+        VxCompactString() {
+            Clear();
+        }
+
+        /// <summary>
+        /// Initializes a new instance of the <see cref="VxCompactString"/> struct.
+        /// </summary>
+        /// <param name="ref">The reference.</param>
+        VxCompactString(const VxCompactString& ref) {
+            Utilities::StrCopySafe(this->value, ref.value);
+            this->pooledValue = ref.pooledValue;
+        }
+
+        /// <summary>
+        /// Clears this instance.
+        /// </summary>
+        void Clear() {
+            VxZeroArray(this->value);
+            this->pooledValue = nullptr;
+        }
+
+        /// <summary>
+        /// Sets the string value.
+        /// </summary>
+        /// <param name="src">The new value.</param>
+        /// <param name="pool">The pool to intern <paramref name="src"/> in if it is too long to store inline.</param>
+        void Set(const char* src, VxStringPool& pool) {
+            Clear();
+            if (src == nullptr)
+                return;
+
+            if (strlen(src) < kInlineLength)
+                Utilities::StrCopySafe(this->value, src);
+            else
+                this->pooledValue = pool.Intern(src);
+        }
+
+        /// <summary>
+        /// Gets the string value.
+        /// </summary>
+        /// <returns>The string value.</returns>
+        const char* Get() const {
+            return this->pooledValue != nullptr ? this->pooledValue : this->value;
+        }
+
+        operator const char*() const {
+            return Get();
+        }
+
+    private:
+        char value[kInlineLength];
+        const char* pooledValue;
+    };
+}
+
+#endif // VxCompactString_h__
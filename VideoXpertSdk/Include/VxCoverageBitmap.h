@@ -0,0 +1,176 @@
+#ifndef VxCoverageBitmap_h__
+#define VxCoverageBitmap_h__
+
+#include "VxPrimitives.h"
+#include "VxUtilities.h"
+#include "VxMacros.h"
+#include "VxRecordingTimeline.h"
+#include <bitset>
+#include <vector>
+
+namespace VxSdk {
+    /// <summary>
+    /// The recording coverage of a data source over a fixed time window at a fixed resolution, one bit per slot.
+    /// Bitmaps with the same window and resolution can be combined with <see cref="And"/> and <see cref="Or"/>,
+    /// e.g. to find the time recorded by all or any of a set of data sources; both operate on 64 slots at a time.
+    /// <para>
+    /// All times are in milliseconds since the Unix epoch (UTC), see <see cref="Utilities::ParseIsoTime"/>. The
+    /// last slot ends at the end of the window, so it is shorter than the resolution when the window is not a whole
+    /// number of slots.
+    /// </para>
+    /// </summary>
+    struct VxCoverageBitmap {
+    public:
+        /// <summary>
+        /// Initializes a new instance of the <see cref="VxCoverageBitmap"/> struct with no recorded slots.
+        /// </summary>
+        /// <param name="start">The start of the window.</param>
+        /// <param name="end">The end of the window.</param>
+        /// <param name="resolutionMs">The duration of each slot, in milliseconds.</param>
+        VxCoverageBitmap(long long start, long long end, int resolutionMs = 1000) {
+            Initialize(start, end, resolutionMs);
+        }
+
+        /// <summary>
+        /// Initializes a new instance of the <see cref="VxCoverageBitmap"/> struct from a recording timeline. A slot
+        /// is set only if it is recorded for its entire duration.
+        /// </summary>
+        /// <param name="timeline">The recording timeline.</param>
+        /// <param name="start">The start of the window.</param>
+        /// <param name="end">The end of the window.</param>
+        /// <param name="resolutionMs">The duration of each slot, in milliseconds.</param>
+        VxCoverageBitmap(const VxRecordingTimeline& timeline, long long start, long long end,
+            int resolutionMs = 1000) {
+            Initialize(start, end, resolutionMs);
+            std::vector<VxRecordingTimeline::Run> runs;
+            timeline.GetRuns(start, GetEnd(), runs);
+            for (size_t i = 0; i < runs.size(); i++)
+                SetRecorded(runs[i].first, runs[i].second);
+        }
+
+        /// <summary>
+        /// Sets the slots that lie entirely within a recorded time range.
+        /// </summary>
+        /// <param name="start">The start of the range.</param>
+        /// <param name="end">The end of the range.</param>
+        void SetRecorded(long long start, long long end) {
+            // Round inwards so that partially recorded slots stay clear
+            long long offset = start - this->start;
+            long long first = offset > 0 ? (offset + this->resolutionMs - 1) / this->resolutionMs : 0;
+            long long last = end > this->start ? (end - this->start) / this->resolutionMs : 0;
+            if (last > this->slotCount || end >= this->end)
+                last = this->slotCount;
+
+            while (first < last) {
+                size_t word = static_cast<size_t>(first / 64);
+                int bit = static_cast<int>(first % 64);
+                int bits = static_cast<int>(last - first < 64 - bit ? last - first : 64 - bit);
+                unsigned long long mask = bits == 64 ? ~0ULL : ((1ULL << bits) - 1) << bit;
+                this->words[word] |= mask;
+                first += bits;
+            }
+        }
+
+        /// <summary>
+        /// Clears the slots not set in another bitmap, leaving the slots recorded in both.
+        /// </summary>
+        /// <param name="other">A bitmap with the same window and resolution.</param>
+        /// <returns>The <see cref="VxResult::Value">Result</see> of the operation.</returns>
+        VxResult::Value And(const VxCoverageBitmap& other) {
+            if (!IsCompatible(other))
+                return VxResult::kInvalidParameters;
+
+            for (size_t i = 0; i < this->words.size(); i++)
+                this->words[i] &= other.words[i];
+
+            return VxResult::kOK;
+        }
+
+        /// <summary>
+        /// Sets the slots set in another bitmap, leaving the slots recorded in either.
+        /// </summary>
+        /// <param name="other">A bitmap with the same window and resolution.</param>
+        /// <returns>The <see cref="VxResult::Value">Result</see> of the operation.</returns>
+        VxResult::Value Or(const VxCoverageBitmap& other) {
+            if (!IsCompatible(other))
+                return VxResult::kInvalidParameters;
+
+            for (size_t i = 0; i < this->words.size(); i++)
+                this->words[i] |= other.words[i];
+
+            return VxResult::kOK;
+        }
+
+        /// <summary>
+        /// Gets the number of recorded slots.
+        /// </summary>
+        /// <returns>The recorded slot count.</returns>
+        int GetRecordedCount() const {
+            size_t count = 0;
+            for (size_t i = 0; i < this->words.size(); i++)
+                count += std::bitset<64>(this->words[i]).count();
+
+            return static_cast<int>(count);
+        }
+
+        /// <summary>
+        /// Gets the end of the window.
+        /// </summary>
+        /// <returns>The end of the window.</returns>
+        long long GetEnd() const {
+            return this->end;
+        }
+
+        /// <summary>
+        /// Gets the number of slots.
+        /// </summary>
+        /// <returns>The slot count.</returns>
+        int GetSlotCount() const {
+            return this->slotCount;
+        }
+
+        /// <summary>
+        /// Gets whether every slot is recorded, i.e. whether recording is continuous over the window.
+        /// </summary>
+        /// <returns><c>true</c> if every slot is recorded, otherwise <c>false</c>.</returns>
+        bool IsFullyRecorded() const {
+            return GetRecordedCount() == this->slotCount;
+        }
+
+        /// <summary>
+        /// Gets whether the slot containing a time is recorded.
+        /// </summary>
+        /// <param name="time">The time.</param>
+        /// <returns><c>true</c> if the slot is recorded, <c>false</c> if not or if it is outside the window.</returns>
+        bool IsRecorded(long long time) const {
+            if (time < this->start || time >= GetEnd())
+                return false;
+
+            long long slot = (time - this->start) / this->resolutionMs;
+            return (this->words[static_cast<size_t>(slot / 64)] >> (slot % 64) & 1) != 0;
+        }
+
+    private:
+        void Initialize(long long start, long long end, int resolutionMs) {
+            this->start = start;
+            this->end = end > start ? end : start;
+            this->resolutionMs = resolutionMs > 0 ? resolutionMs : 1000;
+            long long slots = end > start ? (end - start + this->resolutionMs - 1) / this->resolutionMs : 0;
+            this->slotCount = static_cast<int>(slots);
+            this->words.assign((this->slotCount + 63) / 64, 0);
+        }
+
+        bool IsCompatible(const VxCoverageBitmap& other) const {
+            return this->start == other.start && this->end == other.end &&
+                this->resolutionMs == other.resolutionMs;
+        }
+
+        long long start;
+        long long end;
+        int resolutionMs;
+        int slotCount;
+        std::vector<unsigned long long> words;
+    };
+}
+
+#endif // VxCoverageBitmap_h__
@@ -0,0 +1,177 @@
+#ifndef VxDeltaSync_h__
+#define VxDeltaSync_h__
+
+#include "VxPrimitives.h"
+#include "VxUtilities.h"
+#include "VxMacros.h"
+#include "IVxSituation.h"
+#include "IVxSystem.h"
+#include "VxCollection.h"
+#include "VxCollectionPager.h"
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+namespace VxSdk {
+    namespace Internal {
+        template<typename TItem>
+        inline const char* VxResourceKey(const TItem& item) {
+            return item.id;
+        }
+
+        // Situations have no identifier of their own; the situation type is unique
+        inline const char* VxResourceKey(const IVxSituation& situation) {
+            return situation.type;
+        }
+    }
+
+    /// <summary>
+    /// Keeps a client side mirror of a system resource list (e.g. <see cref="IVxSystem::GetDataSources"/>) up to
+    /// date by reporting only the items that changed and the identifiers of the items that were removed since the
+    /// previous synchronization.
+    /// <para>
+    /// Changes are requested using <see cref="VxCollectionFilterItem::kModifiedSince"/> with the system time of the
+    /// previous synchronization as the sync token. Removals are detected by comparing the total item count with the
+    /// known items; only when they differ are the current identifiers retrieved to determine which were removed.
+    /// </para>
+    /// </summary>
+    /// <typeparam name="TItem">
+    /// The item type, e.g. <see cref="IVxDataSource"/>; must have an <c>id</c> field or be <see cref="IVxSituation"/>.
+    /// </typeparam>
+    template<typename TItem>
+    struct VxDeltaSync {
+    public:
+        /// <summary>
+        /// A method on <see cref="IVxSystem"/> that fills a <see cref="VxCollection{T}"/> and supports the
+        /// kModifiedSince filter, e.g. <c>&amp;IVxSystem::GetDataSources</c>.
+        /// </summary>
+        typedef VxResult::Value(IVxSystem::*Request)(VxCollection<TItem**>&) const;
+
+        /// <summary>
+        /// Initializes a new instance of the <see cref="VxDeltaSync{TItem}"/> struct.
+        /// </summary>
+        /// <param name="system">The system to synchronize with.</param>
+        /// <param name="request">The collection request to synchronize.</param>
+        /// <param name="pageSize">The maximum number of items to retrieve per request.</param>
+        VxDeltaSync(const IVxSystem& system, Request request, int pageSize = 500) {
+            this->system = &system;
+            this->request = request;
+            this->pageSize = pageSize;
+        }
+
+        /// <summary>
+        /// Reports the changes since the previous synchronization. The first synchronization reports every item as
+        /// changed.
+        /// </summary>
+        /// <param name="onChanged">
+        /// Called as <c>onChanged(const TItem&amp; item)</c> for each added or modified item; the item is only valid
+        /// for the duration of the call.
+        /// </param>
+        /// <param name="onRemoved">
+        /// Called as <c>onRemoved(const char* id)</c> for each removed item; situations are identified by type.
+        /// </param>
+        /// <returns>The <see cref="VxResult::Value">Result</see> of the request.</returns>
+        template<typename TOnChanged, typename TOnRemoved>
+        VxResult::Value Sync(TOnChanged onChanged, TOnRemoved onRemoved) {
+            // Take the new token before querying so that changes made during the query are reported next time
+            char now[64];
+            VxResult::Value result = this->system->GetSystemTime(now);
+            if (result != VxResult::kOK)
+                return result;
+
+            VxCollectionFilter modifiedSince;
+            modifiedSince.key = VxCollectionFilterItem::kModifiedSince;
+            Utilities::StrCopySafe(modifiedSince.value, this->syncToken.c_str());
+            bool isFullSync = this->syncToken.empty();
+
+            int added = 0;
+            std::unordered_set<std::string> changedIds;
+            VxCollectionPager<TItem, IVxSystem> changed(*this->system, this->request,
+                isFullSync ? nullptr : &modifiedSince, isFullSync ? 0 : 1, this->pageSize);
+            typedef typename VxCollectionPager<TItem, IVxSystem>::Iterator Iterator;
+            for (Iterator it = changed.begin(); it != changed.end(); ++it) {
+                TItem* item = *it;
+                const char* id = Internal::VxResourceKey(*item);
+                if (this->knownIds.count(id) == 0)
+                    added++;
+                changedIds.insert(id);
+                onChanged(*item);
+            }
+
+            if (changed.result != VxResult::kOK)
+                return changed.result;
+
+            if (isFullSync) {
+                this->knownIds.swap(changedIds);
+                this->syncToken = now;
+                return VxResult::kOK;
+            }
+
+            // Unless the total no longer adds up there is nothing to remove; if the total is not reported, check
+            // every identifier
+            int count = -1;
+            result = VxGetCollectionCount(*this->system, this->request, count);
+            if (result != VxResult::kOK && result != VxResult::kActionUnavailable)
+                return result;
+
+            if (count != static_cast<int>(this->knownIds.size()) + added) {
+                std::unordered_set<std::string> currentIds;
+                VxCollectionPager<TItem, IVxSystem> all(*this->system, this->request, nullptr, 0, this->pageSize);
+                for (Iterator it = all.begin(); it != all.end(); ++it)
+                    currentIds.insert(Internal::VxResourceKey(**it));
+
+                if (all.result != VxResult::kOK)
+                    return all.result;
+
+                for (std::unordered_set<std::string>::const_iterator it = this->knownIds.begin();
+                    it != this->knownIds.end(); ++it) {
+                    if (currentIds.count(*it) == 0)
+                        onRemoved(it->c_str());
+                }
+
+                this->knownIds.swap(currentIds);
+            }
+            else
+                this->knownIds.insert(changedIds.begin(), changedIds.end());
+
+            this->syncToken = now;
+            return VxResult::kOK;
+        }
+
+        /// <summary>
+        /// Restores the state of a previous synchronization, e.g. one saved before the application restarted.
+        /// </summary>
+        /// <param name="syncToken">The sync token of the previous synchronization.</param>
+        /// <param name="knownIds">The identifiers of the items known after the previous synchronization.</param>
+        void Reset(const char* syncToken, const std::vector<std::string>& knownIds) {
+            this->syncToken = syncToken != nullptr ? syncToken : "";
+            this->knownIds.clear();
+            this->knownIds.insert(knownIds.begin(), knownIds.end());
+        }
+
+        /// <summary>
+        /// Gets the sync token of the previous synchronization.
+        /// </summary>
+        /// <returns>The sync token, or an empty string if no synchronization has completed.</returns>
+        const std::string& GetSyncToken() const {
+            return this->syncToken;
+        }
+
+        /// <summary>
+        /// Gets the identifiers of the items known after the previous synchronization.
+        /// </summary>
+        /// <returns>The known item identifiers.</returns>
+        const std::unordered_set<std::string>& GetKnownIds() const {
+            return this->knownIds;
+        }
+
+    private:
+        const IVxSystem* system;
+        Request request;
+        int pageSize;
+        std::string syncToken;
+        std::unordered_set<std::string> knownIds;
+    };
+}
+
+#endif // VxDeltaSync_h__
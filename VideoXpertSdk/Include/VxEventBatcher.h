@@ -0,0 +1,211 @@
+#ifndef VxEventBatcher_h__
+#define VxEventBatcher_h__
+
+#include "VxPrimitives.h"
+#include "VxUtilities.h"
+#include "VxMacros.h"
+#include "IVxEvent.h"
+#include "IVxSystem.h"
+#include "VxCallbackContext.h"
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace VxSdk {
+    /// <summary>
+    /// The callback used to deliver a batch of events. The callback takes ownership of each event and must call
+    /// <see cref="IVxEvent::Delete"/> on it; the array itself is only valid for the duration of the call.
+    /// </summary>
+    typedef void(*VxEventBatchCallback)(IVxEvent** events, int count, void* userData);
+
+    /// <summary>
+    /// Collects event notifications and delivers them in batches on a dedicated thread. A batch is delivered as soon
+    /// as it reaches the maximum batch size or the oldest event in it reaches the maximum latency, whichever comes
+    /// first.
+    /// </summary>
+    struct VxEventBatcher {
+    public:
+        /// <summary>
+        /// Initializes a new instance of the <see cref="VxEventBatcher"/> struct.
+        /// </summary>
+        /// <param name="callback">The callback to deliver each batch to.</param>
+        /// <param name="userData">The context to pass to <paramref name="callback"/>.</param>
+        /// <param name="maxBatchSize">The number of events that triggers delivery of a batch.</param>
+        /// <param name="maxLatencyMs">The maximum time, in milliseconds, an event is held before delivery.</param>
+        VxEventBatcher(VxEventBatchCallback callback, void* userData = nullptr, int maxBatchSize = 100,
+            int maxLatencyMs = 250) {
+            this->callback = callback;
+            this->userData = userData;
+            this->maxBatchSize = maxBatchSize > 0 ? maxBatchSize : 1;
+            this->maxLatencyMs = maxLatencyMs > 0 ? maxLatencyMs : 0;
+            this->exiting = false;
+            this->flushRequested = false;
+            this->system = nullptr;
+            this->worker = std::thread(&VxEventBatcher::Run, this);
+        }
+
+        /// <summary>
+        /// Finalizes an instance of the <see cref="VxEventBatcher"/> class. Any pending events are delivered first.
+        /// </summary>
+        ~VxEventBatcher() {
+            Stop();
+            {
+                std::lock_guard<std::mutex> lock(this->mutex);
+                this->exiting = true;
+            }
+            this->condition.notify_one();
+            this->worker.join();
+        }
+
+        /// <summary>
+        /// Start receiving batched event notifications from a system.
+        /// </summary>
+        /// <param name="system">The system to receive event notifications from.</param>
+        /// <returns>The <see cref="VxResult::Value">Result</see> of the request.</returns>
+        VxResult::Value Start(const IVxSystem& system) {
+            VxEventCallback eventCallback = VxCallbackContext<IVxEvent>::Bind(this, &VxEventBatcher::OnEvent, this);
+            if (eventCallback == nullptr)
+                return VxResult::kInsufficientResources;
+
+            return Started(system, system.StartNotifications(eventCallback));
+        }
+
+        /// <summary>
+        /// Start receiving batched event notifications from a system by situation type.
+        /// </summary>
+        /// <param name="system">The system to receive event notifications from.</param>
+        /// <param name="situationCollection">The situations to subscribe to.</param>
+        /// <param name="userNotification"><c>true</c> to receive user role notifications, otherwise <c>false</c>.</param>
+        /// <returns>The <see cref="VxResult::Value">Result</see> of the request.</returns>
+        VxResult::Value Start(const IVxSystem& system, VxCollection<IVxSituation**>& situationCollection,
+            bool userNotification = false) {
+            VxEventCallback eventCallback = VxCallbackContext<IVxEvent>::Bind(this, &VxEventBatcher::OnEvent, this);
+            if (eventCallback == nullptr)
+                return VxResult::kInsufficientResources;
+
+            return Started(system, system.StartNotifications(eventCallback, situationCollection, userNotification));
+        }
+
+        /// <summary>
+        /// Stop receiving event notifications and deliver any pending events.
+        /// <para>
+        /// This calls <see cref="IVxSystem::StopNotifications"/>, which ends every event notification subscription
+        /// on the system, including those started by the application or by another batcher, queue or filter.
+        /// Restart those subscriptions afterwards if they are still needed.
+        /// </para>
+        /// </summary>
+        /// <returns>The <see cref="VxResult::Value">Result</see> of the request.</returns>
+        VxResult::Value Stop() {
+            VxResult::Value result = VxResult::kOK;
+            if (this->system != nullptr) {
+                result = this->system->StopNotifications();
+                VxCallbackContext<IVxEvent>::Unbind(this);
+                this->system = nullptr;
+            }
+
+            Flush();
+            return result;
+        }
+
+        /// <summary>
+        /// Adds an event to the current batch; may be used to feed events from an existing callback.
+        /// </summary>
+        /// <param name="event">The event to add, ownership of which is passed to the batch callback.</param>
+        void Push(IVxEvent* event) {
+            bool notify;
+            {
+                std::lock_guard<std::mutex> lock(this->mutex);
+                if (this->pending.empty())
+                    this->deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(this->maxLatencyMs);
+
+                this->pending.push_back(event);
+                notify = this->pending.size() == 1 || static_cast<int>(this->pending.size()) >= this->maxBatchSize;
+            }
+
+            if (notify)
+                this->condition.notify_one();
+        }
+
+        /// <summary>
+        /// Delivers any pending events immediately and waits for the delivery to complete.
+        /// </summary>
+        void Flush() {
+            std::unique_lock<std::mutex> lock(this->mutex);
+            this->flushRequested = true;
+            this->condition.notify_one();
+            this->flushed.wait(lock, [this] { return !this->flushRequested; });
+        }
+
+    private:
+        VxEventBatcher(const VxEventBatcher&);
+        VxEventBatcher& operator=(const VxEventBatcher&);
+
+        // Keeps the system, and therefore the binding, only once notifications have started, so that a failed
+        // Start leaves nothing for Stop to tear down
+        VxResult::Value Started(const IVxSystem& system, VxResult::Value result) {
+            if (result == VxResult::kOK)
+                this->system = &system;
+            else if (this->system == nullptr)
+                VxCallbackContext<IVxEvent>::Unbind(this);
+
+            return result;
+        }
+
+        static void OnEvent(IVxEvent* event, void* batcher) {
+            static_cast<VxEventBatcher*>(batcher)->Push(event);
+        }
+
+        void Run() {
+            std::vector<IVxEvent*> batch;
+            std::unique_lock<std::mutex> lock(this->mutex);
+            while (true) {
+                this->condition.wait(lock, [this] {
+                    return this->exiting || this->flushRequested || !this->pending.empty();
+                });
+                if (!this->exiting && !this->flushRequested) {
+                    this->condition.wait_until(lock, this->deadline, [this] {
+                        return this->exiting || this->flushRequested ||
+                            static_cast<int>(this->pending.size()) >= this->maxBatchSize;
+                    });
+                }
+
+                // Deliver whatever is pending; a timeout means the deadline has been reached
+                bool flush = this->flushRequested;
+                batch.swap(this->pending);
+                lock.unlock();
+                for (size_t i = 0; i < batch.size(); i += this->maxBatchSize) {
+                    int count = static_cast<int>(batch.size() - i);
+                    this->callback(&batch[i], count < this->maxBatchSize ? count : this->maxBatchSize, this->userData);
+                }
+                batch.clear();
+                lock.lock();
+
+                if (flush) {
+                    this->flushRequested = false;
+                    this->flushed.notify_all();
+                }
+
+                if (this->exiting && this->pending.empty())
+                    return;
+            }
+        }
+
+        VxEventBatchCallback callback;
+        void* userData;
+        int maxBatchSize;
+        int maxLatencyMs;
+        bool exiting;
+        bool flushRequested;
+        const IVxSystem* system;
+        std::vector<IVxEvent*> pending;
+        std::chrono::steady_clock::time_point deadline;
+        std::mutex mutex;
+        std::condition_variable condition;
+        std::condition_variable flushed;
+        std::thread worker;
+    };
+}
+
+#endif // VxEventBatcher_h__
@@ -0,0 +1,203 @@
+#ifndef VxEventBulk_h__
+#define VxEventBulk_h__
+
+#include "VxPrimitives.h"
+#include "VxUtilities.h"
+#include "VxMacros.h"
+#include "IVxEvent.h"
+#include "IVxSystem.h"
+#include "VxAsync.h"
+#include "VxCollection.h"
+#include "VxNewEvent.h"
+#include <atomic>
+#include <condition_variable>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+namespace VxSdk {
+    namespace Internal {
+        struct VxParallelState {
+            VxParallelState(int count) : next(0), doneCount(0), results(count, VxResult::kOK) { }
+
+            std::atomic<int> next;
+            int doneCount;
+            std::vector<VxResult::Value> results;
+            std::mutex mutex;
+            std::condition_variable condition;
+        };
+
+        template<typename TAction>
+        VxResult::Value VxForEachInParallel(VxAsyncExecutor& executor, int count, int parallelism,
+            VxResult::Value* results, TAction action) {
+            if (count <= 0)
+                return VxResult::kOK;
+
+            // The calling thread works through the items as well. It waits for the items rather than for the
+            // executor tasks, which may still be queued behind other work; a task that starts after every item has
+            // been taken does nothing, so the shared state is kept alive until it has run
+            std::shared_ptr<VxParallelState> state = std::make_shared<VxParallelState>(count);
+            TAction* actionPtr = &action;
+            auto worker = [state, count, actionPtr]() {
+                for (int i = state->next++; i < count; i = state->next++) {
+                    VxResult::Value result = (*actionPtr)(i);
+                    std::lock_guard<std::mutex> lock(state->mutex);
+                    state->results[i] = result;
+                    if (++state->doneCount == count)
+                        state->condition.notify_all();
+                }
+
+                return VxResult::kOK;
+            };
+
+            for (int i = 1; i < parallelism && i < count; i++)
+                executor.RunWithCallback(nullptr, nullptr, worker);
+            worker();
+
+            std::unique_lock<std::mutex> lock(state->mutex);
+            state->condition.wait(lock, [&state, count] { return state->doneCount == count; });
+            VxResult::Value result = VxResult::kOK;
+            for (int i = 0; i < count; i++) {
+                if (results != nullptr)
+                    results[i] = state->results[i];
+                if (result == VxResult::kOK)
+                    result = state->results[i];
+            }
+
+            return result;
+        }
+
+        template<typename TAction>
+        VxResult::Value VxUpdateEvents(const IVxSystem& system, VxAsyncExecutor& executor,
+            VxCollectionFilter* filters, int filterSize, int parallelism, TAction action) {
+            const int kPageSize = 500;
+            std::vector<VxCollectionFilter> pageFilters;
+            for (int i = 0; i < filterSize; i++) {
+                VxCollectionFilterItem::Value key = filters[i].key;
+                if (key != VxCollectionFilterItem::kStart && key != VxCollectionFilterItem::kCount)
+                    pageFilters.push_back(filters[i]);
+            }
+
+            int startFilter = static_cast<int>(pageFilters.size());
+            pageFilters.resize(startFilter + 2);
+            pageFilters[startFilter].key = VxCollectionFilterItem::kStart;
+            pageFilters[startFilter + 1].key = VxCollectionFilterItem::kCount;
+            snprintf(pageFilters[startFilter + 1].value, sizeof(pageFilters[0].value), "%d", kPageSize);
+
+            // Updating an event may move it out of the filtered results (e.g. when filtering by ack state), so each
+            // page is requested again after it is updated; events still present are skipped on the next pass
+            std::unordered_set<std::string> updatedIds;
+            VxResult::Value result = VxResult::kOK;
+            int start = 0;
+            while (true) {
+                snprintf(pageFilters[startFilter].value, sizeof(pageFilters[0].value), "%d", start);
+                VxCollection<IVxEvent**> page;
+                page.filters = &pageFilters[0];
+                page.filterSize = startFilter + 2;
+                page.collectionSize = kPageSize;
+                page.collection = new IVxEvent*[kPageSize];
+                VxResult::Value pageResult = system.GetEvents(page);
+                if (pageResult == VxResult::kInsufficientSize) {
+                    delete[] page.collection;
+                    page.collection = new IVxEvent*[page.collectionSize];
+                    pageResult = system.GetEvents(page);
+                }
+
+                if (pageResult != VxResult::kOK) {
+                    delete[] page.collection;
+                    return pageResult;
+                }
+
+                std::vector<IVxEvent*> pending;
+                for (int i = 0; i < page.collectionSize; i++) {
+                    if (page.collection[i] != nullptr && updatedIds.insert(page.collection[i]->id).second)
+                        pending.push_back(page.collection[i]);
+                }
+
+                VxResult::Value updateResult = VxForEachInParallel(executor, static_cast<int>(pending.size()),
+                    parallelism, nullptr, [&](int i) { return action(*pending[i]); });
+                if (result == VxResult::kOK)
+                    result = updateResult;
+
+                int size = page.collectionSize;
+                page.Release();
+                if (size == 0)
+                    break;
+                if (pending.empty())
+                    start += size;
+            }
+
+            return result;
+        }
+    }
+
+    /// <summary>
+    /// Acknowledges all events on a system matching the given filters, keeping up to
+    /// <paramref name="parallelism"/> requests in flight at once.
+    /// <para>Available filters: the filters available for <see cref="IVxSystem::GetEvents"/>.</para>
+    /// </summary>
+    /// <param name="system">The system the events reside on.</param>
+    /// <param name="executor">
+    /// The executor that runs the requests; the calling thread runs requests as well while it waits.
+    /// </param>
+    /// <param name="filters">The filters that select the events to acknowledge.</param>
+    /// <param name="filterSize">The size of <paramref name="filters"/>.</param>
+    /// <param name="parallelism">The maximum number of requests in flight at once.</param>
+    /// <returns>The <see cref="VxResult::Value">Result</see> of the request.</returns>
+    inline VxResult::Value VxAcknowledgeEvents(const IVxSystem& system, VxAsyncExecutor& executor,
+        VxCollectionFilter* filters, int filterSize, int parallelism = 8) {
+        return Internal::VxUpdateEvents(system, executor, filters, filterSize, parallelism,
+            [](const IVxEvent& event) { return event.Acknowledge(); });
+    }
+
+    /// <summary>
+    /// Inserts a batch of new events into a system, keeping up to <paramref name="parallelism"/> requests in flight
+    /// at once.
+    /// </summary>
+    /// <param name="system">The system to inject the events into.</param>
+    /// <param name="executor">
+    /// The executor that runs the requests; the calling thread runs requests as well while it waits.
+    /// </param>
+    /// <param name="newEvents">The new events to be injected into the system.</param>
+    /// <param name="count">The size of <paramref name="newEvents"/>.</param>
+    /// <param name="results">
+    /// Optional array, the size of <paramref name="newEvents"/>, that receives the result for each event.
+    /// </param>
+    /// <param name="parallelism">The maximum number of requests in flight at once.</param>
+    /// <returns>
+    /// <see cref="VxResult::kOK"/> if every event was inserted, otherwise the first failed
+    /// <see cref="VxResult::Value">Result</see>.
+    /// </returns>
+    inline VxResult::Value VxInsertEvents(const IVxSystem& system, VxAsyncExecutor& executor, VxNewEvent* newEvents,
+        int count, VxResult::Value* results = nullptr, int parallelism = 8) {
+        return Internal::VxForEachInParallel(executor, count, parallelism, results, [&](int i) {
+            return system.InsertEvent(newEvents[i]);
+        });
+    }
+
+    /// <summary>
+    /// Silences all events on a system matching the given filters for a given amount of time, keeping up to
+    /// <paramref name="parallelism"/> requests in flight at once.
+    /// <para>Available filters: the filters available for <see cref="IVxSystem::GetEvents"/>.</para>
+    /// </summary>
+    /// <param name="system">The system the events reside on.</param>
+    /// <param name="executor">
+    /// The executor that runs the requests; the calling thread runs requests as well while it waits.
+    /// </param>
+    /// <param name="filters">The filters that select the events to silence.</param>
+    /// <param name="filterSize">The size of <paramref name="filters"/>.</param>
+    /// <param name="wakeup">The delay, in seconds, to apply prior to the events being brought to the users
+    /// attention.</param>
+    /// <param name="parallelism">The maximum number of requests in flight at once.</param>
+    /// <returns>The <see cref="VxResult::Value">Result</see> of the request.</returns>
+    inline VxResult::Value VxSilenceEvents(const IVxSystem& system, VxAsyncExecutor& executor,
+        VxCollectionFilter* filters, int filterSize, int wakeup, int parallelism = 8) {
+        return Internal::VxUpdateEvents(system, executor, filters, filterSize, parallelism,
+            [wakeup](const IVxEvent& event) { return event.Silence(wakeup); });
+    }
+}
+
+#endif // VxEventBulk_h__
@@ -0,0 +1,313 @@
+#ifndef VxEventFilter_h__
+#define VxEventFilter_h__
+
+#include "VxPrimitives.h"
+#include "VxUtilities.h"
+#include "VxMacros.h"
+#include "IVxEvent.h"
+#include "IVxSituation.h"
+#include "IVxSystem.h"
+#include "VxCallbackContext.h"
+#include "VxCollectionFilter.h"
+#include <cctype>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+namespace VxSdk {
+    /// <summary>
+    /// Filters event notifications using the <see cref="VxCollectionFilterItem"/> keys supported by
+    /// <see cref="IVxSystem::GetEvents"/>: kAckState, kGeneratorDeviceId, kSeverity, kSituationType and
+    /// kSourceDeviceId. Each filter value may be a comma-separated list; kSeverity also accepts ranges such as
+    /// <c>1-3</c>. Filters with different keys must all match, values of the same key are alternatives.
+    /// <para>
+    /// Situation types are applied by the server through a situation subscription. The remaining keys are applied
+    /// as each notification arrives, before it reaches any user callback; rejected events are deleted immediately.
+    /// </para>
+    /// </summary>
+    struct VxEventFilter {
+    public:
+        /// <summary>
+        /// Initializes a new instance of the <see cref="VxEventFilter"/> struct.
+        /// </summary>
+        /// <param name="filters">The filters to apply.</param>
+        /// <param name="filterSize">The size of <paramref name="filters"/>.</param>
+        VxEventFilter(VxCollectionFilter* filters, int filterSize) {
+            this->isValid = true;
+            this->callback = nullptr;
+            this->userData = nullptr;
+            this->system = nullptr;
+            for (int i = 0; i < filterSize; i++) {
+                std::vector<std::string> values = Split(filters[i].value);
+                switch (filters[i].key) {
+                case VxCollectionFilterItem::kAckState:
+                    for (size_t j = 0; j < values.size(); j++) {
+                        VxAckState::Value ackState = ParseAckState(values[j]);
+                        if (ackState == VxAckState::kUnknown)
+                            this->isValid = false;
+                        this->ackStates.push_back(ackState);
+                    }
+                    break;
+                case VxCollectionFilterItem::kGeneratorDeviceId:
+                    this->generatorDeviceIds.insert(this->generatorDeviceIds.end(), values.begin(), values.end());
+                    break;
+                case VxCollectionFilterItem::kSeverity:
+                    for (size_t j = 0; j < values.size(); j++) {
+                        int low, high;
+                        if (!ParseSeverity(values[j], low, high))
+                            this->isValid = false;
+                        this->severities.push_back(low);
+                        this->severities.push_back(high);
+                    }
+                    break;
+                case VxCollectionFilterItem::kSituationType:
+                    this->situationTypes.insert(this->situationTypes.end(), values.begin(), values.end());
+                    break;
+                case VxCollectionFilterItem::kSourceDeviceId:
+                    this->sourceDeviceIds.insert(this->sourceDeviceIds.end(), values.begin(), values.end());
+                    break;
+                default:
+                    this->isValid = false;
+                    break;
+                }
+            }
+        }
+
+        /// <summary>
+        /// Finalizes an instance of the <see cref="VxEventFilter"/> class.
+        /// </summary>
+        ~VxEventFilter() {
+            Stop();
+        }
+
+        /// <summary>
+        /// Determines whether an event satisfies all of the filters.
+        /// </summary>
+        /// <param name="event">The event to test.</param>
+        /// <returns><c>true</c> if the event matches, otherwise <c>false</c>.</returns>
+        bool Matches(const IVxEvent& event) const {
+            if (!this->sourceDeviceIds.empty() && !Contains(this->sourceDeviceIds, event.sourceDeviceId))
+                return false;
+            if (!this->generatorDeviceIds.empty() && !Contains(this->generatorDeviceIds, event.generatorDeviceId))
+                return false;
+            if (!this->situationTypes.empty() && !Contains(this->situationTypes, event.situationType))
+                return false;
+
+            if (!this->severities.empty()) {
+                bool found = false;
+                for (size_t i = 0; i < this->severities.size() && !found; i += 2)
+                    found = event.severity >= this->severities[i] && event.severity <= this->severities[i + 1];
+                if (!found)
+                    return false;
+            }
+
+            if (!this->ackStates.empty()) {
+                bool found = false;
+                for (size_t i = 0; i < this->ackStates.size() && !found; i++)
+                    found = event.ackState == this->ackStates[i];
+                if (!found)
+                    return false;
+            }
+
+            return true;
+        }
+
+        /// <summary>
+        /// Start receiving the event notifications that match the filters.
+        /// </summary>
+        /// <param name="system">The system to receive event notifications from.</param>
+        /// <param name="callback">The callback to be used when a matching event is received.</param>
+        /// <param name="userData">The context to pass to <paramref name="callback"/>.</param>
+        /// <param name="userNotification">
+        /// <c>true</c> to receive user role notifications, otherwise <c>false</c>. Only supported with a
+        /// kSituationType filter; without one the notification settings of the current user apply.
+        /// </param>
+        /// <returns>
+        /// The <see cref="VxResult::Value">Result</see> of the request; <see cref="VxResult::kInvalidParameters"/> if
+        /// a filter is invalid, <paramref name="userNotification"/> is set without a kSituationType filter, or the
+        /// situation types do not match any situation.
+        /// </returns>
+        VxResult::Value Start(const IVxSystem& system, VxEventContextCallback callback, void* userData,
+            bool userNotification = false) {
+            if (!this->isValid || callback == nullptr || (userNotification && this->situationTypes.empty()))
+                return VxResult::kInvalidParameters;
+
+            VxEventCallback eventCallback = VxCallbackContext<IVxEvent>::Bind(this, &VxEventFilter::OnEvent, this);
+            if (eventCallback == nullptr)
+                return VxResult::kInsufficientResources;
+
+            this->callback = callback;
+            this->userData = userData;
+            if (this->situationTypes.empty())
+                return Started(system, system.StartNotifications(eventCallback));
+
+            // Subscribe to only the situations of the requested types
+            std::vector<IVxSituation*> situations;
+            VxResult::Value result = VxResult::kOK;
+            for (size_t i = 0; i < this->situationTypes.size() && result == VxResult::kOK; i++)
+                result = GetSituations(system, this->situationTypes[i].c_str(), situations);
+
+            // An empty situation collection would not restrict the subscription to the requested types
+            if (result == VxResult::kOK && situations.empty())
+                result = VxResult::kInvalidParameters;
+
+            if (result == VxResult::kOK) {
+                VxCollection<IVxSituation**> situationCollection;
+                situationCollection.collection = situations.empty() ? nullptr : &situations[0];
+                situationCollection.collectionSize = static_cast<int>(situations.size());
+                result = system.StartNotifications(eventCallback, situationCollection, userNotification);
+            }
+
+            for (size_t i = 0; i < situations.size(); i++)
+                situations[i]->Delete();
+
+            return Started(system, result);
+        }
+
+        /// <summary>
+        /// Stop receiving event notifications.
+        /// <para>
+        /// This calls <see cref="IVxSystem::StopNotifications"/>, which ends every event notification subscription
+        /// on the system, including those started by the application or by another batcher, queue or filter.
+        /// Restart those subscriptions afterwards if they are still needed.
+        /// </para>
+        /// </summary>
+        /// <returns>The <see cref="VxResult::Value">Result</see> of the request.</returns>
+        VxResult::Value Stop() {
+            if (this->system == nullptr)
+                return VxResult::kOK;
+
+            VxResult::Value result = this->system->StopNotifications();
+            VxCallbackContext<IVxEvent>::Unbind(this);
+            this->system = nullptr;
+            return result;
+        }
+
+    private:
+        VxEventFilter(const VxEventFilter&);
+        VxEventFilter& operator=(const VxEventFilter&);
+
+        static void OnEvent(IVxEvent* event, void* eventFilter) {
+            VxEventFilter* filter = static_cast<VxEventFilter*>(eventFilter);
+            if (filter->Matches(*event))
+                filter->callback(event, filter->userData);
+            else
+                event->Delete();
+        }
+
+        // Keeps the system, and therefore the binding, only once notifications have started, so that a failed
+        // Start leaves nothing for Stop to tear down
+        VxResult::Value Started(const IVxSystem& system, VxResult::Value result) {
+            if (result == VxResult::kOK)
+                this->system = &system;
+            else if (this->system == nullptr)
+                VxCallbackContext<IVxEvent>::Unbind(this);
+
+            return result;
+        }
+
+        static bool Contains(const std::vector<std::string>& values, const char* value) {
+            for (size_t i = 0; i < values.size(); i++) {
+                if (values[i] == value)
+                    return true;
+            }
+
+            return false;
+        }
+
+        static std::vector<std::string> Split(const char* value) {
+            std::vector<std::string> values;
+            std::string current;
+            for (const char* c = value; ; c++) {
+                if (*c == ',' || *c == 0) {
+                    size_t first = current.find_first_not_of(' ');
+                    size_t last = current.find_last_not_of(' ');
+                    if (first != std::string::npos)
+                        values.push_back(current.substr(first, last - first + 1));
+                    current.clear();
+                    if (*c == 0)
+                        break;
+                }
+                else
+                    current += *c;
+            }
+
+            return values;
+        }
+
+        static VxAckState::Value ParseAckState(const std::string& value) {
+            // Accepts the server names (e.g. "ack_needed") regardless of case and separators
+            std::string name;
+            for (size_t i = 0; i < value.size(); i++) {
+                if (value[i] != '_' && value[i] != '-')
+                    name += static_cast<char>(tolower(static_cast<unsigned char>(value[i])));
+            }
+
+            if (name == "ackneeded")
+                return VxAckState::kAckNeeded;
+            if (name == "acked")
+                return VxAckState::kAcked;
+            if (name == "autoacked")
+                return VxAckState::kAutoAcked;
+            if (name == "noackneeded")
+                return VxAckState::kNoAckNeeded;
+            if (name == "silenced")
+                return VxAckState::kSilenced;
+            return VxAckState::kUnknown;
+        }
+
+        static bool ParseSeverity(const std::string& value, int& low, int& high) {
+            // Accepts a single severity (e.g. "3") or an inclusive range (e.g. "1-3")
+            const char* start = value.c_str();
+            char* end;
+            low = static_cast<int>(strtol(start, &end, 10));
+            if (end == start)
+                return false;
+
+            high = low;
+            if (*end == '-') {
+                start = end + 1;
+                high = static_cast<int>(strtol(start, &end, 10));
+                if (end == start)
+                    return false;
+            }
+
+            return *end == 0 && low <= high;
+        }
+
+        static VxResult::Value GetSituations(const IVxSystem& system, const char* type,
+            std::vector<IVxSituation*>& situations) {
+            VxCollectionFilter filter;
+            filter.key = VxCollectionFilterItem::kType;
+            Utilities::StrCopySafe(filter.value, type);
+
+            VxCollection<IVxSituation**> situationCollection;
+            situationCollection.filters = &filter;
+            situationCollection.filterSize = 1;
+            VxResult::Value result = system.GetSituations(situationCollection);
+            if (result != VxResult::kInsufficientSize)
+                return result;
+
+            situationCollection.collection = new IVxSituation*[situationCollection.collectionSize];
+            result = system.GetSituations(situationCollection);
+            if (result == VxResult::kOK)
+                situations.insert(situations.end(), situationCollection.collection,
+                    situationCollection.collection + situationCollection.collectionSize);
+
+            delete[] situationCollection.collection;
+            return result;
+        }
+
+        bool isValid;
+        std::vector<VxAckState::Value> ackStates;
+        std::vector<std::string> generatorDeviceIds;
+        std::vector<int> severities;
+        std::vector<std::string> situationTypes;
+        std::vector<std::string> sourceDeviceIds;
+        VxEventContextCallback callback;
+        void* userData;
+        const IVxSystem* system;
+    };
+}
+
+#endif // VxEventFilter_h__
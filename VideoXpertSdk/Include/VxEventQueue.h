@@ -0,0 +1,246 @@
+#ifndef VxEventQueue_h__
+#define VxEventQueue_h__
+
+#include "VxPrimitives.h"
+#include "VxUtilities.h"
+#include "VxMacros.h"
+#include "IVxEvent.h"
+#include "IVxSystem.h"
+#include "VxCallbackContext.h"
+#include <atomic>
+#include <cstddef>
+
+namespace VxSdk {
+    /// <summary>
+    /// A bounded, lock-free queue of event notifications. Events received from a system are pushed by the SDK
+    /// notification thread and removed by any number of consumer threads using <see cref="TryPopEvents"/>, so a
+    /// slow consumer never stalls notification delivery. Events that arrive while the queue is full are deleted
+    /// and counted as dropped.
+    /// </summary>
+    struct VxEventQueue {
+    public:
+        /// <summary>
+        /// Initializes a new instance of the <see cref="VxEventQueue"/> struct.
+        /// </summary>
+        /// <param name="capacity">The maximum number of queued events, rounded up to a power of two.</param>
+        explicit VxEventQueue(int capacity = 4096) {
+            size_t size = 2;
+            while (size < static_cast<size_t>(capacity))
+                size <<= 1;
+
+            this->mask = size - 1;
+            this->cells = new Cell[size];
+            for (size_t i = 0; i < size; i++) {
+                this->cells[i].sequence.store(i, std::memory_order_relaxed);
+                this->cells[i].event = nullptr;
+            }
+
+            this->enqueuePos.store(0, std::memory_order_relaxed);
+            this->dequeuePos.store(0, std::memory_order_relaxed);
+            this->highWaterMark.store(0, std::memory_order_relaxed);
+            this->droppedCount.store(0, std::memory_order_relaxed);
+            this->system = nullptr;
+        }
+
+        /// <summary>
+        /// Finalizes an instance of the <see cref="VxEventQueue"/> class. Any events still queued are deleted.
+        /// </summary>
+        ~VxEventQueue() {
+            Stop();
+            IVxEvent* event;
+            while (TryPopEvents(&event, 1) == 1)
+                event->Delete();
+
+            delete[] this->cells;
+        }
+
+        /// <summary>
+        /// Start queuing event notifications from a system.
+        /// </summary>
+        /// <param name="system">The system to receive event notifications from.</param>
+        /// <returns>The <see cref="VxResult::Value">Result</see> of the request.</returns>
+        VxResult::Value Start(const IVxSystem& system) {
+            VxEventCallback eventCallback = VxCallbackContext<IVxEvent>::Bind(this, &VxEventQueue::OnEvent, this);
+            if (eventCallback == nullptr)
+                return VxResult::kInsufficientResources;
+
+            return Started(system, system.StartNotifications(eventCallback));
+        }
+
+        /// <summary>
+        /// Start queuing event notifications from a system by situation type.
+        /// </summary>
+        /// <param name="system">The system to receive event notifications from.</param>
+        /// <param name="situationCollection">The situations to subscribe to.</param>
+        /// <param name="userNotification"><c>true</c> to receive user role notifications, otherwise <c>false</c>.</param>
+        /// <returns>The <see cref="VxResult::Value">Result</see> of the request.</returns>
+        VxResult::Value Start(const IVxSystem& system, VxCollection<IVxSituation**>& situationCollection,
+            bool userNotification = false) {
+            VxEventCallback eventCallback = VxCallbackContext<IVxEvent>::Bind(this, &VxEventQueue::OnEvent, this);
+            if (eventCallback == nullptr)
+                return VxResult::kInsufficientResources;
+
+            return Started(system, system.StartNotifications(eventCallback, situationCollection, userNotification));
+        }
+
+        /// <summary>
+        /// Stop queuing event notifications. Events already queued remain available.
+        /// <para>
+        /// This calls <see cref="IVxSystem::StopNotifications"/>, which ends every event notification subscription
+        /// on the system, including those started by the application or by another batcher, queue or filter.
+        /// Restart those subscriptions afterwards if they are still needed.
+        /// </para>
+        /// </summary>
+        /// <returns>The <see cref="VxResult::Value">Result</see> of the request.</returns>
+        VxResult::Value Stop() {
+            if (this->system == nullptr)
+                return VxResult::kOK;
+
+            VxResult::Value result = this->system->StopNotifications();
+            VxCallbackContext<IVxEvent>::Unbind(this);
+            this->system = nullptr;
+            return result;
+        }
+
+        /// <summary>
+        /// Adds an event to the queue; may be used to feed events from an existing callback.
+        /// </summary>
+        /// <param name="event">The event to add.</param>
+        /// <returns><c>true</c> if the event was queued, <c>false</c> if the queue was full and the event was
+        /// dropped (ownership of <paramref name="event"/> remains with the caller).</returns>
+        bool Push(IVxEvent* event) {
+            size_t pos = this->enqueuePos.load(std::memory_order_relaxed);
+            Cell* cell;
+            while (true) {
+                cell = &this->cells[pos & this->mask];
+                size_t sequence = cell->sequence.load(std::memory_order_acquire);
+                ptrdiff_t diff = static_cast<ptrdiff_t>(sequence) - static_cast<ptrdiff_t>(pos);
+                if (diff == 0) {
+                    if (this->enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                        break;
+                }
+                else if (diff < 0) {
+                    this->droppedCount.fetch_add(1, std::memory_order_relaxed);
+                    return false;
+                }
+                else
+                    pos = this->enqueuePos.load(std::memory_order_relaxed);
+            }
+
+            cell->event = event;
+            cell->sequence.store(pos + 1, std::memory_order_release);
+
+            // Record the peak queue depth. Consumers may already have moved past this event, in which case the
+            // depth is not positive and is ignored; the dequeue position may also be stale, so clamp to the capacity
+            ptrdiff_t depth = static_cast<ptrdiff_t>(pos + 1 - this->dequeuePos.load(std::memory_order_relaxed));
+            if (depth <= 0)
+                return true;
+
+            int peak = this->highWaterMark.load(std::memory_order_relaxed);
+            int newPeak = static_cast<int>(depth <= static_cast<ptrdiff_t>(this->mask) ? depth : this->mask + 1);
+            while (newPeak > peak) {
+                if (this->highWaterMark.compare_exchange_weak(peak, newPeak, std::memory_order_relaxed))
+                    break;
+            }
+
+            return true;
+        }
+
+        /// <summary>
+        /// Removes up to <paramref name="max"/> events from the queue without blocking.
+        /// </summary>
+        /// <param name="events">The array to fill; the caller takes ownership of each event returned.</param>
+        /// <param name="max">The size of <paramref name="events"/>.</param>
+        /// <returns>The number of events returned in <paramref name="events"/>.</returns>
+        int TryPopEvents(IVxEvent** events, int max) {
+            int count = 0;
+            while (count < max) {
+                size_t pos = this->dequeuePos.load(std::memory_order_relaxed);
+                Cell* cell;
+                while (true) {
+                    cell = &this->cells[pos & this->mask];
+                    size_t sequence = cell->sequence.load(std::memory_order_acquire);
+                    ptrdiff_t diff = static_cast<ptrdiff_t>(sequence) - static_cast<ptrdiff_t>(pos + 1);
+                    if (diff == 0) {
+                        if (this->dequeuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                            break;
+                    }
+                    else if (diff < 0)
+                        return count;
+                    else
+                        pos = this->dequeuePos.load(std::memory_order_relaxed);
+                }
+
+                events[count++] = cell->event;
+                cell->sequence.store(pos + this->mask + 1, std::memory_order_release);
+            }
+
+            return count;
+        }
+
+        /// <summary>
+        /// Gets the approximate number of queued events.
+        /// </summary>
+        /// <returns>The number of queued events.</returns>
+        int Size() const {
+            size_t enqueued = this->enqueuePos.load(std::memory_order_relaxed);
+            size_t dequeued = this->dequeuePos.load(std::memory_order_relaxed);
+            return enqueued > dequeued ? static_cast<int>(enqueued - dequeued) : 0;
+        }
+
+        /// <summary>
+        /// Gets the largest number of events that have been queued at once.
+        /// </summary>
+        /// <returns>The high-water mark.</returns>
+        int GetHighWaterMark() const {
+            return this->highWaterMark.load(std::memory_order_relaxed);
+        }
+
+        /// <summary>
+        /// Gets the number of events dropped because the queue was full.
+        /// </summary>
+        /// <returns>The number of dropped events.</returns>
+        long long GetDroppedCount() const {
+            return this->droppedCount.load(std::memory_order_relaxed);
+        }
+
+    private:
+        VxEventQueue(const VxEventQueue&);
+        VxEventQueue& operator=(const VxEventQueue&);
+
+        struct Cell {
+            std::atomic<size_t> sequence;
+            IVxEvent* event;
+        };
+
+        // Keeps the system, and therefore the binding, only once notifications have started, so that a failed
+        // Start leaves nothing for Stop to tear down
+        VxResult::Value Started(const IVxSystem& system, VxResult::Value result) {
+            if (result == VxResult::kOK)
+                this->system = &system;
+            else if (this->system == nullptr)
+                VxCallbackContext<IVxEvent>::Unbind(this);
+
+            return result;
+        }
+
+        static void OnEvent(IVxEvent* event, void* queue) {
+            if (!static_cast<VxEventQueue*>(queue)->Push(event))
+                event->Delete();
+        }
+
+        // Padding keeps the producer and consumer positions on separate cache lines
+        Cell* cells;
+        size_t mask;
+        char producerPadding[64];
+        std::atomic<size_t> enqueuePos;
+        char consumerPadding[64];
+        std::atomic<size_t> dequeuePos;
+        char statsPadding[64];
+        std::atomic<int> highWaterMark;
+        std::atomic<long long> droppedCount;
+        const IVxSystem* system;
+    };
+}
+
+#endif // VxEventQueue_h__
@@ -0,0 +1,276 @@
+#ifndef VxExportDownloader_h__
+#define VxExportDownloader_h__
+
+#include "VxPrimitives.h"
+#include "VxUtilities.h"
+#include "VxMacros.h"
+#include "IVxExport.h"
+#include <atomic>
+#include <cstdio>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace VxSdk {
+    /// <summary>
+    /// The callback used to read a byte range of a resource, e.g. using an HTTP range request on
+    /// <see cref="IVxExport::dataUri"/> with the session's credentials. It may read fewer bytes than requested.
+    /// </summary>
+    /// <param name="uri">The URI of the resource.</param>
+    /// <param name="offset">The offset of the first byte to read.</param>
+    /// <param name="length">The maximum number of bytes to read.</param>
+    /// <param name="buffer">The buffer to read into; at least <paramref name="length"/> bytes.</param>
+    /// <param name="bytesRead">The number of bytes read; 0 at the end of the resource.</param>
+    /// <param name="totalSize">The total size of the resource in bytes, e.g. from the Content-Range header.</param>
+    /// <param name="userData">The context supplied with the callback.</param>
+    /// <returns>The <see cref="VxResult::Value">Result</see> of the read.</returns>
+    typedef VxResult::Value(*VxRangeReadCallback)(const char* uri, long long offset, int length, char* buffer,
+        int& bytesRead, long long& totalSize, void* userData);
+
+    /// <summary>
+    /// The callback used to report download progress. It is called from the download threads, one call at a time.
+    /// </summary>
+    typedef void(*VxDownloadProgressCallback)(long long bytesDownloaded, long long totalBytes, void* userData);
+
+    namespace Internal {
+        // Reads until the range is filled, retrying failed reads. An empty read either ends the range early (when
+        // reading up to the end of a resource) or is retried like a failed read (when the range must be filled)
+        inline VxResult::Value VxReadRange(VxRangeReadCallback reader, void* userData, const char* uri,
+            long long offset, int length, char* buffer, bool stopAtEnd, int& filled, long long& totalSize) {
+            const int kMaxAttempts = 3;
+            int failures = 0;
+            filled = 0;
+            while (filled < length) {
+                int bytesRead = 0;
+                VxResult::Value result = reader(uri, offset + filled, length - filled, buffer + filled, bytesRead,
+                    totalSize, userData);
+                if (result == VxResult::kOK && bytesRead <= 0 && stopAtEnd)
+                    break;
+
+                if (result != VxResult::kOK || bytesRead <= 0) {
+                    if (++failures >= kMaxAttempts)
+                        return result != VxResult::kOK ? result : VxResult::kOperationFailed;
+                    continue;
+                }
+
+                filled += bytesRead;
+            }
+
+            return VxResult::kOK;
+        }
+    }
+
+    /// <summary>
+    /// Downloads the data of a completed export in fixed size chunks, several at a time, straight into a
+    /// preallocated file. Progress is recorded alongside the file so that an interrupted download resumes with
+    /// the chunks that are still missing; the record is removed once the download is complete.
+    /// <para>
+    /// The SDK does not expose its HTTP connection, so the byte ranges are read using a caller supplied
+    /// <see cref="VxRangeReadCallback"/>.
+    /// </para>
+    /// </summary>
+    struct VxExportDownloader {
+    public:
+        /// <summary>
+        /// Initializes a new instance of the <see cref="VxExportDownloader"/> struct.
+        /// </summary>
+        /// <param name="reader">The callback used to read each chunk.</param>
+        /// <param name="userData">The context to pass to <paramref name="reader"/>.</param>
+        /// <param name="chunkSizeKb">The size of each chunk, in kilobytes.</param>
+        VxExportDownloader(VxRangeReadCallback reader, void* userData = nullptr, int chunkSizeKb = 4096) {
+            this->reader = reader;
+            this->userData = userData;
+            this->chunkSize = (chunkSizeKb > 0 ? chunkSizeKb : 4096) * 1024;
+        }
+
+        /// <summary>
+        /// Downloads the data of a completed export.
+        /// </summary>
+        /// <param name="exportItem">The export; its <see cref="IVxExport::dataUri"/> must be set.</param>
+        /// <param name="path">The file to download to.</param>
+        /// <param name="parallelism">The maximum number of chunks to download at once.</param>
+        /// <param name="progress">The callback to report progress to, or <c>nullptr</c>.</param>
+        /// <param name="progressUserData">The context to pass to <paramref name="progress"/>.</param>
+        /// <returns>
+        /// The <see cref="VxResult::Value">Result</see> of the download; kOperationFailed if the downloaded size
+        /// does not match <see cref="IVxExport::fileSizeKb"/>.
+        /// </returns>
+        VxResult::Value Download(const IVxExport& exportItem, const char* path, int parallelism = 4,
+            VxDownloadProgressCallback progress = nullptr, void* progressUserData = nullptr) const {
+            if (exportItem.dataUri[0] == '\0')
+                return VxResult::kActionUnavailable;
+
+            long long totalSize = 0;
+            VxResult::Value result = Download(exportItem.dataUri, path, parallelism, progress, progressUserData,
+                totalSize);
+            if (result != VxResult::kOK)
+                return result;
+
+            // The reported size is rounded to kilobytes
+            long long sizeKb = totalSize / 1024;
+            if (exportItem.fileSizeKb > 0 && (sizeKb < exportItem.fileSizeKb - 1 || sizeKb > exportItem.fileSizeKb + 1))
+                return VxResult::kOperationFailed;
+
+            return VxResult::kOK;
+        }
+
+        /// <summary>
+        /// Downloads a resource.
+        /// </summary>
+        /// <param name="uri">The URI of the resource.</param>
+        /// <param name="path">The file to download to.</param>
+        /// <param name="parallelism">The maximum number of chunks to download at once.</param>
+        /// <param name="progress">The callback to report progress to, or <c>nullptr</c>.</param>
+        /// <param name="progressUserData">The context to pass to <paramref name="progress"/>.</param>
+        /// <param name="totalSize">The size of the resource, in bytes.</param>
+        /// <returns>The <see cref="VxResult::Value">Result</see> of the download.</returns>
+        VxResult::Value Download(const char* uri, const char* path, int parallelism,
+            VxDownloadProgressCallback progress, void* progressUserData, long long& totalSize) const {
+            char probe;
+            int bytesRead = 0;
+            totalSize = -1;
+            VxResult::Value result = this->reader(uri, 0, 1, &probe, bytesRead, totalSize, this->userData);
+            if (result != VxResult::kOK)
+                return result;
+            if (totalSize < 0)
+                return VxResult::kOperationFailed;
+
+            std::string partsPath = std::string(path) + ".parts";
+            int chunkCount = static_cast<int>((totalSize + this->chunkSize - 1) / this->chunkSize);
+            std::vector<char> completed(chunkCount, 0);
+            FILE* file = nullptr;
+            FILE* parts = nullptr;
+            if (!Resume(path, partsPath.c_str(), totalSize, completed, file, parts) &&
+                !Create(path, partsPath.c_str(), totalSize, completed, file, parts))
+                return VxResult::kOperationFailed;
+
+            long long downloaded = 0;
+            for (int i = 0; i < chunkCount; i++) {
+                if (completed[i])
+                    downloaded += ChunkLength(i, totalSize);
+            }
+
+            std::mutex mutex;
+            std::atomic<int> next(0);
+            VxResult::Value downloadResult = VxResult::kOK;
+            auto worker = [&]() {
+                std::vector<char> chunk(this->chunkSize);
+                for (int i = next++; i < chunkCount; i = next++) {
+                    if (completed[i])
+                        continue;
+
+                    long long offset = static_cast<long long>(i) * this->chunkSize;
+                    int length = ChunkLength(i, totalSize);
+                    VxResult::Value chunkResult = ReadChunk(uri, offset, length, &chunk[0]);
+                    std::lock_guard<std::mutex> lock(mutex);
+                    if (chunkResult == VxResult::kOK && (Seek(file, offset) != 0 ||
+                        fwrite(&chunk[0], 1, length, file) != static_cast<size_t>(length) || fflush(file) != 0))
+                        chunkResult = VxResult::kOperationFailed;
+
+                    if (chunkResult != VxResult::kOK) {
+                        if (downloadResult == VxResult::kOK)
+                            downloadResult = chunkResult;
+                        next = chunkCount;
+                        return;
+                    }
+
+                    // Only record the chunk once its data has been flushed
+                    completed[i] = 1;
+                    if (Seek(parts, kPartsHeaderSize + i) == 0 && fputc(1, parts) != EOF)
+                        fflush(parts);
+
+                    downloaded += length;
+                    if (progress != nullptr)
+                        progress(downloaded, totalSize, progressUserData);
+                }
+            };
+
+            std::vector<std::thread> workers;
+            for (int i = 1; i < parallelism && i < chunkCount; i++)
+                workers.push_back(std::thread(worker));
+            worker();
+            for (size_t i = 0; i < workers.size(); i++)
+                workers[i].join();
+
+            fclose(parts);
+            if (fclose(file) != 0 && downloadResult == VxResult::kOK)
+                downloadResult = VxResult::kOperationFailed;
+            if (downloadResult == VxResult::kOK)
+                remove(partsPath.c_str());
+
+            return downloadResult;
+        }
+
+    private:
+        static const int kPartsHeaderSize = 2 * sizeof(long long);
+
+        // Opens an existing download and its progress record, if the record belongs to a download of the same size
+        bool Resume(const char* path, const char* partsPath, long long totalSize, std::vector<char>& completed,
+            FILE*& file, FILE*& parts) const {
+            parts = fopen(partsPath, "r+b");
+            file = parts != nullptr ? fopen(path, "r+b") : nullptr;
+            long long header[2];
+            size_t chunkCount = completed.size();
+            if (file != nullptr && fread(header, sizeof(header), 1, parts) == 1 && header[0] == totalSize &&
+                header[1] == this->chunkSize &&
+                (chunkCount == 0 || fread(&completed[0], 1, chunkCount, parts) == chunkCount))
+                return true;
+
+            Close(file, parts);
+            completed.assign(chunkCount, 0);
+            return false;
+        }
+
+        // Creates the preallocated file and an empty progress record
+        bool Create(const char* path, const char* partsPath, long long totalSize, std::vector<char>& completed,
+            FILE*& file, FILE*& parts) const {
+            file = fopen(path, "w+b");
+            parts = fopen(partsPath, "w+b");
+            long long header[2] = { totalSize, this->chunkSize };
+            size_t chunkCount = completed.size();
+            if (file != nullptr && parts != nullptr && fwrite(header, sizeof(header), 1, parts) == 1 &&
+                (chunkCount == 0 || fwrite(&completed[0], 1, chunkCount, parts) == chunkCount) && fflush(parts) == 0 &&
+                (totalSize == 0 || (Seek(file, totalSize - 1) == 0 && fputc(0, file) != EOF)) && fflush(file) == 0)
+                return true;
+
+            Close(file, parts);
+            return false;
+        }
+
+        static void Close(FILE*& file, FILE*& parts) {
+            if (file != nullptr)
+                fclose(file);
+            if (parts != nullptr)
+                fclose(parts);
+            file = nullptr;
+            parts = nullptr;
+        }
+
+        int ChunkLength(int index, long long totalSize) const {
+            long long remaining = totalSize - static_cast<long long>(index) * this->chunkSize;
+            return static_cast<int>(remaining < this->chunkSize ? remaining : this->chunkSize);
+        }
+
+        VxResult::Value ReadChunk(const char* uri, long long offset, int length, char* buffer) const {
+            int filled = 0;
+            long long totalSize = 0;
+            return Internal::VxReadRange(this->reader, this->userData, uri, offset, length, buffer, false, filled,
+                totalSize);
+        }
+
+        static int Seek(FILE* file, long long offset) {
+#if defined(_WIN32)
+            return _fseeki64(file, offset, SEEK_SET);
+#else
+            return fseeko(file, static_cast<off_t>(offset), SEEK_SET);
+#endif
+        }
+
+        VxRangeReadCallback reader;
+        void* userData;
+        int chunkSize;
+    };
+}
+
+#endif // VxExportDownloader_h__
@@ -0,0 +1,131 @@
+#ifndef VxExportStreamReader_h__
+#define VxExportStreamReader_h__
+
+#include "VxPrimitives.h"
+#include "VxUtilities.h"
+#include "VxMacros.h"
+#include "VxExportDownloader.h"
+#include "VxExportStreamClip.h"
+#include <string>
+
+namespace VxSdk {
+    /// <summary>
+    /// Reads exported media sequentially, e.g. from <see cref="VxExportStreamClip::videoUrl"/> or
+    /// <see cref="IVxExport::dataUri"/>, so that it can be forwarded without being written to disk first. Each read
+    /// fills the caller's buffer directly; the reader holds no buffer of its own, so memory use is bounded by the
+    /// buffer the caller provides.
+    /// <para>
+    /// The SDK does not expose its HTTP connection, so the media is read using a caller supplied
+    /// <see cref="VxRangeReadCallback"/>.
+    /// </para>
+    /// </summary>
+    struct VxExportStreamReader {
+    public:
+        /// <summary>
+        /// Initializes a new instance of the <see cref="VxExportStreamReader"/> struct.
+        /// </summary>
+        /// <param name="reader">The callback used to read the media.</param>
+        /// <param name="userData">The context to pass to <paramref name="reader"/>.</param>
+        /// <param name="uri">The URI of the media.</param>
+        VxExportStreamReader(VxRangeReadCallback reader, void* userData, const char* uri) {
+            Initialize(reader, userData, uri);
+        }
+
+        /// <summary>
+        /// Initializes a new instance of the <see cref="VxExportStreamReader"/> struct.
+        /// </summary>
+        /// <param name="reader">The callback used to read the media.</param>
+        /// <param name="userData">The context to pass to <paramref name="reader"/>.</param>
+        /// <param name="clip">The export stream clip to read.</param>
+        /// <param name="audio"><c>true</c> to read the audio of the clip, <c>false</c> to read the video.</param>
+        VxExportStreamReader(VxRangeReadCallback reader, void* userData, const VxExportStreamClip& clip,
+            bool audio = false) {
+            Initialize(reader, userData, audio ? clip.audioUrl : clip.videoUrl);
+        }
+
+        /// <summary>
+        /// Gets the current read position.
+        /// </summary>
+        /// <returns>The offset, in bytes, of the next byte to read.</returns>
+        long long GetPosition() const {
+            return this->position;
+        }
+
+        /// <summary>
+        /// Gets the total size of the media, as reported by the most recent read.
+        /// </summary>
+        /// <returns>The total size in bytes, or -1 if it is not known yet.</returns>
+        long long GetTotalSize() const {
+            return this->totalSize;
+        }
+
+        /// <summary>
+        /// Reads the next chunk of media into a buffer. The buffer is filled completely unless the end of the media
+        /// is reached.
+        /// </summary>
+        /// <param name="buffer">The buffer to read into.</param>
+        /// <param name="size">The size of <paramref name="buffer"/>.</param>
+        /// <param name="bytesRead">The number of bytes read.</param>
+        /// <returns>
+        /// The <see cref="VxResult::Value">Result</see> of the read; <see cref="VxResult::kEndOfStream"/> once all
+        /// of the media has been read.
+        /// </returns>
+        VxResult::Value Read(char* buffer, int size, int& bytesRead) {
+            bytesRead = 0;
+            if (this->isEndOfStream || (this->totalSize >= 0 && this->position >= this->totalSize))
+                return VxResult::kEndOfStream;
+            if (buffer == nullptr || size <= 0)
+                return VxResult::kInvalidParameters;
+
+            int length = size;
+            if (this->totalSize >= 0 && this->totalSize - this->position < length)
+                length = static_cast<int>(this->totalSize - this->position);
+
+            VxResult::Value result = Internal::VxReadRange(this->reader, this->userData, this->uri.c_str(),
+                this->position, length, buffer, true, bytesRead, this->totalSize);
+            this->position += bytesRead;
+            if (result != VxResult::kOK)
+                return result;
+
+            if (bytesRead < length)
+                this->isEndOfStream = true;
+            if (bytesRead == 0)
+                return VxResult::kEndOfStream;
+
+            return VxResult::kOK;
+        }
+
+        /// <summary>
+        /// Moves the read position, e.g. to resume forwarding after a failure.
+        /// </summary>
+        /// <param name="position">The offset, in bytes, of the next byte to read.</param>
+        /// <returns>The <see cref="VxResult::Value">Result</see> of the request.</returns>
+        VxResult::Value Seek(long long position) {
+            if (position < 0 || (this->totalSize >= 0 && position > this->totalSize))
+                return VxResult::kInvalidParameters;
+
+            this->position = position;
+            this->isEndOfStream = false;
+            return VxResult::kOK;
+        }
+
+    private:
+        void Initialize(VxRangeReadCallback reader, void* userData, const char* uri) {
+            this->reader = reader;
+            this->userData = userData;
+            this->uri = uri != nullptr ? uri : "";
+            this->position = 0;
+            this->totalSize = -1;
+            this->isEndOfStream = false;
+        }
+
+        VxRangeReadCallback reader;
+        void* userData;
+        std::string uri;
+        long long position;
+        long long totalSize;
+        bool isEndOfStream;
+    };
+}
+
+#endif // VxExportStreamReader_h__
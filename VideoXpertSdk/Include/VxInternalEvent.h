@@ -78,6 +78,7 @@ namespace VxSdk {
     };
 
     typedef void(*VxInternalEventCallback)(VxInternalEvent*);
+    typedef void(*VxInternalEventContextCallback)(VxInternalEvent*, void* userData);
 }
 
 #endif // VxInternalEvent_h__
@@ -0,0 +1,369 @@
+#ifndef VxInventorySnapshot_h__
+#define VxInventorySnapshot_h__
+
+#include "VxPrimitives.h"
+#include "VxUtilities.h"
+#include "VxMacros.h"
+#include "IVxSystem.h"
+#include "VxDeltaSync.h"
+#include <cstdio>
+#include <cstring>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#if defined(_WIN32)
+// Declared here rather than including windows.h, whose macros (e.g. DeleteFile, min and max) break other headers
+extern "C" __declspec(dllimport) int __stdcall MoveFileExA(const char* existingFileName, const char* newFileName,
+    unsigned long flags);
+#endif
+
+namespace VxSdk {
+    /// <summary>
+    /// Represents a resource in a <see cref="VxInventorySnapshot"/>.
+    /// </summary>
+    struct VxInventoryItem {
+    public:
+        /// <summary>
+        /// Initializes a new instance of the <see cref="VxInventoryItem"/> struct.
+        /// </summary>
+        VxInventoryItem() {
+            Clear();
+        }
+
+        /// <summary>
+        /// Clears this instance.
+        /// </summary>
+        void Clear() {
+            VxZeroArray(this->id);
+            VxZeroArray(this->name);
+        }
+
+    public:
+        /// <summary>
+        /// The unique identifier of the resource; the situation type for situations.
+        /// </summary>
+        char id[MAX_SITUATION_TYPE_LENGTH];
+        /// <summary>
+        /// The friendly name of the resource.
+        /// </summary>
+        char name[MAX_SITUATION_NAME_LENGTH];
+    };
+
+    /// <summary>
+    /// A versioned, on-disk snapshot of the resources on a system that can be loaded immediately after login, so
+    /// that the resource lists are available before they have been retrieved from the system. Each list stores the
+    /// sync token of its <see cref="VxDeltaSync{TItem}"/>, which <see cref="Reconcile"/> then uses to bring the
+    /// list up to date; reconciliation may run on a background thread while the lists are read.
+    /// <para>
+    /// Items are stored as fixed size records, so the snapshot only holds the resource identifiers and names; the
+    /// full resources must still be requested from the system when needed.
+    /// </para>
+    /// <para>This header is not included by VxSdk.h and must be included explicitly.</para>
+    /// </summary>
+    struct VxInventorySnapshot {
+    public:
+        /// <summary>
+        /// Values that represent the resource lists in a snapshot.
+        /// </summary>
+        struct List {
+            enum Value {
+                /// <summary>The list returned by <see cref="IVxSystem::GetDataSources"/>.</summary>
+                kDataSources,
+                /// <summary>The list returned by <see cref="IVxSystem::GetDevices"/>.</summary>
+                kDevices,
+                /// <summary>The list returned by <see cref="IVxSystem::GetRoles"/>.</summary>
+                kRoles,
+                /// <summary>The list returned by <see cref="IVxSystem::GetSituations"/>.</summary>
+                kSituations,
+                /// <summary>The list returned by <see cref="IVxSystem::GetTags"/>.</summary>
+                kTags
+            };
+        };
+
+        /// <summary>
+        /// The current snapshot file format version.
+        /// </summary>
+        static const unsigned int kVersion = 1;
+
+        /// <summary>
+        /// Initializes a new instance of the <see cref="VxInventorySnapshot"/> struct.
+        /// </summary>
+        VxInventorySnapshot() { }
+
+        /// <summary>
+        /// Gets the path of the snapshot file for a system.
+        /// </summary>
+        /// <param name="directory">The directory containing the snapshot files.</param>
+        /// <param name="systemId">The unique identifier of the system, see <see cref="IVxSystem::id"/>.</param>
+        /// <returns>The snapshot file path.</returns>
+        static std::string GetPath(const char* directory, const char* systemId) {
+            std::string path = directory;
+            if (!path.empty() && path[path.size() - 1] != '/' && path[path.size() - 1] != '\\')
+                path += '/';
+
+            return path + systemId + ".vxinventory";
+        }
+
+        /// <summary>
+        /// Gets the items of a resource list.
+        /// </summary>
+        /// <param name="list">The resource list.</param>
+        /// <returns>A copy of the items in the list.</returns>
+        std::vector<VxInventoryItem> GetItems(List::Value list) const {
+            std::lock_guard<std::mutex> lock(this->mutex);
+            return this->sections[list].items;
+        }
+
+        /// <summary>
+        /// Gets the sync token of a resource list.
+        /// </summary>
+        /// <param name="list">The resource list.</param>
+        /// <returns>The sync token, or an empty string if the list has never been synchronized.</returns>
+        std::string GetSyncToken(List::Value list) const {
+            std::lock_guard<std::mutex> lock(this->mutex);
+            return this->sections[list].syncToken;
+        }
+
+        /// <summary>
+        /// Loads a snapshot file, replacing the contents of this snapshot.
+        /// </summary>
+        /// <param name="path">The snapshot file path, see <see cref="GetPath"/>.</param>
+        /// <returns>
+        /// The <see cref="VxResult::Value">Result</see> of loading the file; kUnsupportedVersion if the file was
+        /// written by a different version, in which case it should be discarded.
+        /// </returns>
+        VxResult::Value Load(const char* path) {
+            FILE* file = fopen(path, "rb");
+            if (file == nullptr)
+                return VxResult::kActionUnavailable;
+
+            Section loaded[kListCount];
+            VxResult::Value result = Read(file, loaded);
+            fclose(file);
+            if (result != VxResult::kOK)
+                return result;
+
+            std::lock_guard<std::mutex> lock(this->mutex);
+            for (int i = 0; i < kListCount; i++)
+                this->sections[i].Swap(loaded[i]);
+
+            return VxResult::kOK;
+        }
+
+        /// <summary>
+        /// Saves this snapshot. The snapshot is written to a temporary file which then atomically replaces the
+        /// existing file, so an interrupted save leaves the previous snapshot intact.
+        /// </summary>
+        /// <param name="path">The snapshot file path, see <see cref="GetPath"/>.</param>
+        /// <returns>The <see cref="VxResult::Value">Result</see> of saving the file.</returns>
+        VxResult::Value Save(const char* path) const {
+            std::string tempPath = std::string(path) + ".tmp";
+            FILE* file = fopen(tempPath.c_str(), "wb");
+            if (file == nullptr)
+                return VxResult::kActionUnavailable;
+
+            bool written;
+            {
+                std::lock_guard<std::mutex> lock(this->mutex);
+                written = Write(file);
+            }
+
+            written = fclose(file) == 0 && written;
+            if (!written || !Replace(tempPath.c_str(), path)) {
+                remove(tempPath.c_str());
+                return VxResult::kOperationFailed;
+            }
+
+            return VxResult::kOK;
+        }
+
+        /// <summary>
+        /// Restores the state of a <see cref="VxDeltaSync{TItem}"/> from a resource list, so that its next
+        /// synchronization only reports the changes since this snapshot was taken.
+        /// </summary>
+        /// <param name="list">The resource list.</param>
+        /// <param name="deltaSync">The delta sync to restore.</param>
+        template<typename TItem>
+        void Restore(List::Value list, VxDeltaSync<TItem>& deltaSync) const {
+            std::lock_guard<std::mutex> lock(this->mutex);
+            const Section& section = this->sections[list];
+            std::vector<std::string> ids;
+            ids.reserve(section.items.size());
+            for (size_t i = 0; i < section.items.size(); i++)
+                ids.push_back(section.items[i].id);
+
+            deltaSync.Reset(section.syncToken.c_str(), ids);
+        }
+
+        /// <summary>
+        /// Brings a resource list up to date using a <see cref="VxDeltaSync{TItem}"/> that was restored from it (see
+        /// <see cref="Restore"/>), or a new one to populate the list from scratch.
+        /// </summary>
+        /// <param name="list">The resource list.</param>
+        /// <param name="deltaSync">The delta sync for the resource list.</param>
+        /// <returns>The <see cref="VxResult::Value">Result</see> of the synchronization.</returns>
+        template<typename TItem>
+        VxResult::Value Reconcile(List::Value list, VxDeltaSync<TItem>& deltaSync) {
+            std::vector<VxInventoryItem> changed;
+            std::vector<std::string> removed;
+            VxResult::Value result = deltaSync.Sync(ChangedCollector<TItem>(changed), RemovedCollector(removed));
+            if (result != VxResult::kOK)
+                return result;
+
+            std::lock_guard<std::mutex> lock(this->mutex);
+            Section& section = this->sections[list];
+            // When every known item was reported, e.g. on a first synchronization, replace rather than merge
+            if (deltaSync.GetKnownIds().size() == changed.size())
+                section.items.clear();
+
+            std::unordered_map<std::string, size_t> index;
+            for (size_t i = 0; i < section.items.size(); i++)
+                index[section.items[i].id] = i;
+
+            for (size_t i = 0; i < changed.size(); i++) {
+                std::unordered_map<std::string, size_t>::iterator it = index.find(changed[i].id);
+                if (it != index.end())
+                    section.items[it->second] = changed[i];
+                else {
+                    index[changed[i].id] = section.items.size();
+                    section.items.push_back(changed[i]);
+                }
+            }
+
+            if (!removed.empty()) {
+                std::unordered_map<std::string, size_t> removedIds;
+                for (size_t i = 0; i < removed.size(); i++)
+                    removedIds[removed[i]] = i;
+
+                std::vector<VxInventoryItem> remaining;
+                remaining.reserve(section.items.size());
+                for (size_t i = 0; i < section.items.size(); i++) {
+                    if (removedIds.count(section.items[i].id) == 0)
+                        remaining.push_back(section.items[i]);
+                }
+
+                section.items.swap(remaining);
+            }
+
+            section.syncToken = deltaSync.GetSyncToken();
+            return VxResult::kOK;
+        }
+
+    private:
+        static const int kListCount = List::kTags + 1;
+        static const unsigned int kMagic = 0x56584956;
+
+        struct Section {
+            void Swap(Section& other) {
+                this->syncToken.swap(other.syncToken);
+                this->items.swap(other.items);
+            }
+
+            std::string syncToken;
+            std::vector<VxInventoryItem> items;
+        };
+
+        template<typename TItem>
+        struct ChangedCollector {
+            explicit ChangedCollector(std::vector<VxInventoryItem>& items) : items(&items) { }
+
+            void operator()(const TItem& item) const {
+                VxInventoryItem inventoryItem;
+                Utilities::StrCopySafe(inventoryItem.id, Internal::VxResourceKey(item));
+                Utilities::StrCopySafe(inventoryItem.name, item.name);
+                this->items->push_back(inventoryItem);
+            }
+
+            std::vector<VxInventoryItem>* items;
+        };
+
+        struct RemovedCollector {
+            explicit RemovedCollector(std::vector<std::string>& ids) : ids(&ids) { }
+
+            void operator()(const char* id) const {
+                this->ids->push_back(id);
+            }
+
+            std::vector<std::string>* ids;
+        };
+
+        static bool Replace(const char* sourcePath, const char* path) {
+#if defined(_WIN32)
+            // Unlike POSIX, rename does not replace an existing file on Windows
+            const unsigned long kMoveFileReplaceExisting = 0x1;
+            const unsigned long kMoveFileWriteThrough = 0x8;
+            return MoveFileExA(sourcePath, path, kMoveFileReplaceExisting | kMoveFileWriteThrough) != 0;
+#else
+            return rename(sourcePath, path) == 0;
+#endif
+        }
+
+        static VxResult::Value Read(FILE* file, Section* loaded) {
+            if (fseek(file, 0, SEEK_END) != 0)
+                return VxResult::kOperationFailed;
+
+            long fileSize = ftell(file);
+            rewind(file);
+            unsigned int header[3];
+            if (fread(header, sizeof(header), 1, file) != 1 || header[0] != kMagic)
+                return VxResult::kOperationFailed;
+
+            if (header[1] != kVersion || header[2] != kListCount)
+                return VxResult::kUnsupportedVersion;
+
+            for (int i = 0; i < kListCount; i++) {
+                char syncToken[64];
+                unsigned int itemCount;
+                if (fread(syncToken, sizeof(syncToken), 1, file) != 1 ||
+                    fread(&itemCount, sizeof(itemCount), 1, file) != 1)
+                    return VxResult::kOperationFailed;
+
+                // Reject counts the rest of the file cannot hold before allocating, in case the file is corrupt
+                long remaining = fileSize - ftell(file);
+                if (remaining < 0 || itemCount > static_cast<unsigned long>(remaining) / sizeof(VxInventoryItem))
+                    return VxResult::kOperationFailed;
+
+                syncToken[sizeof(syncToken) - 1] = '\0';
+                loaded[i].syncToken = syncToken;
+                loaded[i].items.resize(itemCount);
+                if (itemCount > 0 &&
+                    fread(&loaded[i].items[0], sizeof(VxInventoryItem), itemCount, file) != itemCount)
+                    return VxResult::kOperationFailed;
+            }
+
+            return VxResult::kOK;
+        }
+
+        bool Write(FILE* file) const {
+            unsigned int header[3] = { kMagic, kVersion, kListCount };
+            if (fwrite(header, sizeof(header), 1, file) != 1)
+                return false;
+
+            for (int i = 0; i < kListCount; i++) {
+                char syncToken[64];
+                VxZeroArray(syncToken);
+                Utilities::StrCopySafe(syncToken, this->sections[i].syncToken.c_str());
+                const std::vector<VxInventoryItem>& items = this->sections[i].items;
+                unsigned int itemCount = static_cast<unsigned int>(items.size());
+                if (fwrite(syncToken, sizeof(syncToken), 1, file) != 1 ||
+                    fwrite(&itemCount, sizeof(itemCount), 1, file) != 1)
+                    return false;
+
+                if (itemCount > 0 && fwrite(&items[0], sizeof(VxInventoryItem), itemCount, file) != itemCount)
+                    return false;
+            }
+
+            return true;
+        }
+
+        Section sections[kListCount];
+        mutable std::mutex mutex;
+
+        VxInventorySnapshot(const VxInventorySnapshot&);
+        VxInventorySnapshot& operator=(const VxInventorySnapshot&);
+    };
+}
+
+#endif // VxInventorySnapshot_h__
@@ -0,0 +1,262 @@
+#ifndef VxRecordingTimeline_h__
+#define VxRecordingTimeline_h__
+
+#include "VxPrimitives.h"
+#include "VxUtilities.h"
+#include "VxMacros.h"
+#include "IVxClip.h"
+#include "IVxGap.h"
+#include "VxCompactClip.h"
+#include "VxCompactGap.h"
+#include "VxCollection.h"
+#include <algorithm>
+#include <map>
+#include <utility>
+#include <vector>
+
+namespace VxSdk {
+    /// <summary>
+    /// The recording timeline of a data source, built from its clips and gaps (see
+    /// <see cref="IVxDataSource::GetClips"/> and <see cref="IVxDataSource::GetGaps"/>). Recorded time is kept as a
+    /// sorted list of coalesced, non-overlapping runs, so lookups take O(log n) in the number of runs. Clips and gaps
+    /// may be added at any time; each is merged into the existing runs without rebuilding the timeline.
+    /// <para>
+    /// All times are in milliseconds since the Unix epoch (UTC), see <see cref="Utilities::ParseIsoTime"/>.
+    /// </para>
+    /// </summary>
+    struct VxRecordingTimeline {
+    public:
+        /// <summary>
+        /// A recorded time range; the start is inclusive and the end is exclusive.
+        /// </summary>
+        typedef std::pair<long long, long long> Run;
+
+        /// <summary>
+        /// Initializes a new instance of the <see cref="VxRecordingTimeline"/> struct.
+        /// </summary>
+        VxRecordingTimeline() { }
+
+        /// <summary>
+        /// Marks the time covered by a clip as recorded.
+        /// </summary>
+        /// <param name="clip">The clip.</param>
+        /// <returns><c>true</c> if the clip times were valid, otherwise <c>false</c>.</returns>
+        bool Add(const IVxClip& clip) {
+            long long start, end;
+            if (!Utilities::ParseIsoTime(clip.startTime, start) || !Utilities::ParseIsoTime(clip.endTime, end))
+                return false;
+
+            AddRecorded(start, end);
+            return true;
+        }
+
+        /// <summary>
+        /// Marks the time covered by a gap as not recorded.
+        /// </summary>
+        /// <param name="gap">The gap.</param>
+        /// <returns><c>true</c> if the gap times were valid, otherwise <c>false</c>.</returns>
+        bool Add(const IVxGap& gap) {
+            long long start, end;
+            if (!Utilities::ParseIsoTime(gap.startTime, start) || !Utilities::ParseIsoTime(gap.endTime, end))
+                return false;
+
+            AddGap(start, end);
+            return true;
+        }
+
+        /// <summary>
+        /// Marks the time covered by a compact clip as recorded.
+        /// </summary>
+        /// <param name="clip">The clip.</param>
+        /// <returns><c>true</c> if the clip times were valid, otherwise <c>false</c>.</returns>
+        bool Add(const VxCompactClip& clip) {
+            if (clip.startTimeMs == 0 || clip.endTimeMs == 0)
+                return false;
+
+            AddRecorded(clip.startTimeMs, clip.endTimeMs);
+            return true;
+        }
+
+        /// <summary>
+        /// Marks the time covered by a compact gap as not recorded.
+        /// </summary>
+        /// <param name="gap">The gap.</param>
+        /// <returns><c>true</c> if the gap times were valid, otherwise <c>false</c>.</returns>
+        bool Add(const VxCompactGap& gap) {
+            if (gap.startTimeMs == 0 || gap.endTimeMs == 0)
+                return false;
+
+            AddGap(gap.startTimeMs, gap.endTimeMs);
+            return true;
+        }
+
+        /// <summary>
+        /// Adds each item in a collection of clips or gaps.
+        /// </summary>
+        /// <param name="collection">The clips or gaps.</param>
+        /// <returns>The number of items whose times were invalid.</returns>
+        template<typename TItem>
+        int Add(const VxCollection<TItem**>& collection) {
+            int invalidCount = 0;
+            for (int i = 0; i < collection.collectionSize; i++) {
+                if (collection.collection[i] != nullptr && !Add(*collection.collection[i]))
+                    invalidCount++;
+            }
+
+            return invalidCount;
+        }
+
+        /// <summary>
+        /// Marks a time range as not recorded.
+        /// </summary>
+        /// <param name="start">The start of the range.</param>
+        /// <param name="end">The end of the range.</param>
+        void AddGap(long long start, long long end) {
+            if (end <= start)
+                return;
+
+            std::map<long long, long long>::iterator it = this->runs.lower_bound(start);
+            if (it != this->runs.begin()) {
+                std::map<long long, long long>::iterator previous = it;
+                --previous;
+                if (previous->second > start) {
+                    // Split or trim the run that the gap starts in
+                    long long previousEnd = previous->second;
+                    previous->second = start;
+                    if (previousEnd > end) {
+                        this->runs[end] = previousEnd;
+                        return;
+                    }
+                }
+            }
+
+            while (it != this->runs.end() && it->first < end) {
+                if (it->second > end) {
+                    long long runEnd = it->second;
+                    this->runs.erase(it);
+                    this->runs[end] = runEnd;
+                    return;
+                }
+
+                this->runs.erase(it++);
+            }
+        }
+
+        /// <summary>
+        /// Marks a time range as recorded.
+        /// </summary>
+        /// <param name="start">The start of the range.</param>
+        /// <param name="end">The end of the range.</param>
+        void AddRecorded(long long start, long long end) {
+            if (end <= start)
+                return;
+
+            // Merge with every run that overlaps or touches the new one
+            std::map<long long, long long>::iterator it = this->runs.upper_bound(start);
+            if (it != this->runs.begin()) {
+                std::map<long long, long long>::iterator previous = it;
+                --previous;
+                if (previous->second >= start) {
+                    start = previous->first;
+                    end = std::max(end, previous->second);
+                    it = previous;
+                }
+            }
+
+            while (it != this->runs.end() && it->first <= end) {
+                end = std::max(end, it->second);
+                this->runs.erase(it++);
+            }
+
+            this->runs[start] = end;
+        }
+
+        /// <summary>
+        /// Clears this instance.
+        /// </summary>
+        void Clear() {
+            this->runs.clear();
+        }
+
+        /// <summary>
+        /// Gets the amount of recorded time within a time range.
+        /// </summary>
+        /// <param name="start">The start of the range.</param>
+        /// <param name="end">The end of the range.</param>
+        /// <returns>The recorded time, in milliseconds.</returns>
+        long long GetCoverage(long long start, long long end) const {
+            long long coverage = 0;
+            for (std::map<long long, long long>::const_iterator it = FindFirst(start);
+                it != this->runs.end() && it->first < end; ++it)
+                coverage += std::min(end, it->second) - std::max(start, it->first);
+
+            return coverage;
+        }
+
+        /// <summary>
+        /// Gets the first recorded run that ends after a given time.
+        /// </summary>
+        /// <param name="time">The time.</param>
+        /// <param name="run">The run; its start is before <paramref name="time"/> if the time is recorded.</param>
+        /// <returns>
+        /// <c>true</c> if there is a recorded run after <paramref name="time"/>, otherwise <c>false</c>.
+        /// </returns>
+        bool GetNextRecorded(long long time, Run& run) const {
+            std::map<long long, long long>::const_iterator it = FindFirst(time);
+            if (it == this->runs.end())
+                return false;
+
+            run = *it;
+            return true;
+        }
+
+        /// <summary>
+        /// Gets the number of recorded runs.
+        /// </summary>
+        /// <returns>The run count.</returns>
+        int GetRunCount() const {
+            return static_cast<int>(this->runs.size());
+        }
+
+        /// <summary>
+        /// Gets the recorded runs that overlap a time range, clipped to the range, e.g. for drawing a timeline.
+        /// </summary>
+        /// <param name="start">The start of the range.</param>
+        /// <param name="end">The end of the range.</param>
+        /// <param name="runs">The recorded runs, in order.</param>
+        void GetRuns(long long start, long long end, std::vector<Run>& runs) const {
+            runs.clear();
+            for (std::map<long long, long long>::const_iterator it = FindFirst(start);
+                it != this->runs.end() && it->first < end; ++it)
+                runs.push_back(Run(std::max(start, it->first), std::min(end, it->second)));
+        }
+
+        /// <summary>
+        /// Gets whether a time is recorded.
+        /// </summary>
+        /// <param name="time">The time.</param>
+        /// <returns><c>true</c> if <paramref name="time"/> is recorded, otherwise <c>false</c>.</returns>
+        bool IsRecorded(long long time) const {
+            std::map<long long, long long>::const_iterator it = FindFirst(time);
+            return it != this->runs.end() && it->first <= time;
+        }
+
+    private:
+        // Finds the first run that ends after the given time
+        std::map<long long, long long>::const_iterator FindFirst(long long time) const {
+            std::map<long long, long long>::const_iterator it = this->runs.upper_bound(time);
+            if (it != this->runs.begin()) {
+                std::map<long long, long long>::const_iterator previous = it;
+                --previous;
+                if (previous->second > time)
+                    return previous;
+            }
+
+            return it;
+        }
+
+        std::map<long long, long long> runs;
+    };
+}
+
+#endif // VxRecordingTimeline_h__
@@ -0,0 +1,358 @@
+#ifndef VxResourceCache_h__
+#define VxResourceCache_h__
+
+#include "VxPrimitives.h"
+#include "VxUtilities.h"
+#include "VxMacros.h"
+#include "IVxDataSource.h"
+#include "IVxDevice.h"
+#include "IVxEvent.h"
+#include "IVxSituation.h"
+#include "IVxSystem.h"
+#include "IVxTag.h"
+#include "VxCollection.h"
+#include "VxCollectionFilter.h"
+#include "VxInternalEvent.h"
+#include <chrono>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace VxSdk {
+    /// <summary>
+    /// The items returned by a <see cref="VxResourceCache"/> read. The items are shared by every reader of the same
+    /// cache entry and are deleted once the last reference is released; they must not be deleted by the caller.
+    /// </summary>
+    /// <typeparam name="TItem">The item type, e.g. <see cref="IVxDataSource"/>.</typeparam>
+    template<typename TItem>
+    struct VxCachedCollection {
+    public:
+        /// <summary>
+        /// Initializes a new instance of the <see cref="VxCachedCollection{TItem}"/> struct.
+        /// </summary>
+        VxCachedCollection() { }
+
+        /// <summary>
+        /// Finalizes an instance of the <see cref="VxCachedCollection{TItem}"/> class.
+        /// </summary>
+        ~VxCachedCollection() {
+            for (size_t i = 0; i < this->items.size(); i++)
+                this->items[i]->Delete();
+        }
+
+    public:
+        /// <summary>
+        /// The cached items.
+        /// </summary>
+        std::vector<TItem*> items;
+
+    private:
+        VxCachedCollection(const VxCachedCollection&);
+        VxCachedCollection& operator=(const VxCachedCollection&);
+    };
+
+    /// <summary>
+    /// An opt-in, client side cache for the resource lists returned by <see cref="IVxSystem::GetDataSources"/>,
+    /// <see cref="IVxSystem::GetDevices"/>, <see cref="IVxSystem::GetTags"/> and
+    /// <see cref="IVxSystem::GetSituations"/>. Each distinct set of filters is cached separately.
+    /// <para>
+    /// Entries are invalidated when notifications passed to <see cref="OnEvent"/> match an invalidation rule, when
+    /// <see cref="OnInternalEvent"/> receives <see cref="VxInternalEventType::kSystemConnectionRestored"/>, when the
+    /// time to live expires or when <see cref="Invalidate"/> is called. The cache does not subscribe to notifications
+    /// itself; forward them from the application's notification callback.
+    /// </para>
+    /// <para>
+    /// By default, <c>system/data_source_*</c> events invalidate the data sources, <c>system/device_*</c> events
+    /// invalidate the devices and data sources, and <c>system/tag_*</c> events invalidate the tags. No situation type
+    /// reports changes to the situations themselves, so cached situations are only refreshed by the time to live or
+    /// by <see cref="Invalidate"/>.
+    /// </para>
+    /// </summary>
+    struct VxResourceCache {
+    public:
+        /// <summary>
+        /// Values that represent the cached resource lists. Values may be combined.
+        /// </summary>
+        struct List {
+            enum Value {
+                /// <summary>No resource list.</summary>
+                kNone = 0x0,
+                /// <summary>The list returned by <see cref="IVxSystem::GetDataSources"/>.</summary>
+                kDataSources = 0x1,
+                /// <summary>The list returned by <see cref="IVxSystem::GetDevices"/>.</summary>
+                kDevices = 0x2,
+                /// <summary>The list returned by <see cref="IVxSystem::GetTags"/>.</summary>
+                kTags = 0x4,
+                /// <summary>The list returned by <see cref="IVxSystem::GetSituations"/>.</summary>
+                kSituations = 0x8,
+                /// <summary>Every resource list.</summary>
+                kAll = 0xF
+            };
+        };
+
+        /// <summary>
+        /// Initializes a new instance of the <see cref="VxResourceCache"/> struct.
+        /// </summary>
+        /// <param name="system">The system to read from.</param>
+        /// <param name="timeToLiveMs">
+        /// The maximum age of an entry in milliseconds, or 0 to keep entries until they are invalidated.
+        /// </param>
+        VxResourceCache(const IVxSystem& system, int timeToLiveMs = 0) {
+            this->system = &system;
+            this->timeToLiveMs = timeToLiveMs;
+            this->hitCount = 0;
+            this->missCount = 0;
+            AddInvalidationRule("system/data_source_", List::kDataSources);
+            AddInvalidationRule("system/device_", List::kDevices | List::kDataSources);
+            AddInvalidationRule("system/tag_", List::kTags);
+        }
+
+        /// <summary>
+        /// Adds a rule that invalidates resource lists when an event of a given situation type is received.
+        /// </summary>
+        /// <param name="situationTypePrefix">
+        /// The situation type, or a prefix of the situation types, that invalidates <paramref name="lists"/>.
+        /// </param>
+        /// <param name="lists">A combination of <see cref="List::Value"/> values to invalidate.</param>
+        void AddInvalidationRule(const char* situationTypePrefix, int lists) {
+            std::lock_guard<std::mutex> lock(this->mutex);
+            this->rules.push_back(Rule(situationTypePrefix, lists));
+        }
+
+        /// <summary>
+        /// Removes every invalidation rule, including the default rules.
+        /// </summary>
+        void ClearInvalidationRules() {
+            std::lock_guard<std::mutex> lock(this->mutex);
+            this->rules.clear();
+        }
+
+        /// <summary>
+        /// Gets the data sources, reading from the cache when possible.
+        /// </summary>
+        /// <param name="dataSources">The cached data sources.</param>
+        /// <param name="filters">The collection filters, or <c>nullptr</c>.</param>
+        /// <param name="filterSize">The size of <paramref name="filters"/>.</param>
+        /// <returns>The <see cref="VxResult::Value">Result</see> of the request.</returns>
+        VxResult::Value GetDataSources(std::shared_ptr<const VxCachedCollection<IVxDataSource> >& dataSources,
+            VxCollectionFilter* filters = nullptr, int filterSize = 0) {
+            return Get(this->dataSources, &IVxSystem::GetDataSources, filters, filterSize, dataSources);
+        }
+
+        /// <summary>
+        /// Gets the devices, reading from the cache when possible.
+        /// </summary>
+        /// <param name="devices">The cached devices.</param>
+        /// <param name="filters">The collection filters, or <c>nullptr</c>.</param>
+        /// <param name="filterSize">The size of <paramref name="filters"/>.</param>
+        /// <returns>The <see cref="VxResult::Value">Result</see> of the request.</returns>
+        VxResult::Value GetDevices(std::shared_ptr<const VxCachedCollection<IVxDevice> >& devices,
+            VxCollectionFilter* filters = nullptr, int filterSize = 0) {
+            return Get(this->devices, &IVxSystem::GetDevices, filters, filterSize, devices);
+        }
+
+        /// <summary>
+        /// Gets the situations, reading from the cache when possible.
+        /// </summary>
+        /// <param name="situations">The cached situations.</param>
+        /// <param name="filters">The collection filters, or <c>nullptr</c>.</param>
+        /// <param name="filterSize">The size of <paramref name="filters"/>.</param>
+        /// <returns>The <see cref="VxResult::Value">Result</see> of the request.</returns>
+        VxResult::Value GetSituations(std::shared_ptr<const VxCachedCollection<IVxSituation> >& situations,
+            VxCollectionFilter* filters = nullptr, int filterSize = 0) {
+            return Get(this->situations, &IVxSystem::GetSituations, filters, filterSize, situations);
+        }
+
+        /// <summary>
+        /// Gets the tags, reading from the cache when possible.
+        /// </summary>
+        /// <param name="tags">The cached tags.</param>
+        /// <param name="filters">The collection filters, or <c>nullptr</c>.</param>
+        /// <param name="filterSize">The size of <paramref name="filters"/>.</param>
+        /// <returns>The <see cref="VxResult::Value">Result</see> of the request.</returns>
+        VxResult::Value GetTags(std::shared_ptr<const VxCachedCollection<IVxTag> >& tags,
+            VxCollectionFilter* filters = nullptr, int filterSize = 0) {
+            return Get(this->tags, &IVxSystem::GetTags, filters, filterSize, tags);
+        }
+
+        /// <summary>
+        /// Gets the number of reads served from the cache.
+        /// </summary>
+        /// <returns>The hit count.</returns>
+        long long GetHitCount() const {
+            std::lock_guard<std::mutex> lock(this->mutex);
+            return this->hitCount;
+        }
+
+        /// <summary>
+        /// Gets the number of reads that had to be requested from the system.
+        /// </summary>
+        /// <returns>The miss count.</returns>
+        long long GetMissCount() const {
+            std::lock_guard<std::mutex> lock(this->mutex);
+            return this->missCount;
+        }
+
+        /// <summary>
+        /// Invalidates cached resource lists.
+        /// </summary>
+        /// <param name="lists">A combination of <see cref="List::Value"/> values to invalidate.</param>
+        void Invalidate(int lists = List::kAll) {
+            std::lock_guard<std::mutex> lock(this->mutex);
+            if (lists & List::kDataSources)
+                this->dataSources.Clear();
+            if (lists & List::kDevices)
+                this->devices.Clear();
+            if (lists & List::kSituations)
+                this->situations.Clear();
+            if (lists & List::kTags)
+                this->tags.Clear();
+        }
+
+        /// <summary>
+        /// Invalidates the resource lists affected by an event notification, based on the invalidation rules.
+        /// </summary>
+        /// <param name="systemEvent">The event notification.</param>
+        void OnEvent(const IVxEvent& systemEvent) {
+            int lists = List::kNone;
+            {
+                std::lock_guard<std::mutex> lock(this->mutex);
+                for (size_t i = 0; i < this->rules.size(); i++) {
+                    const std::string& prefix = this->rules[i].situationTypePrefix;
+                    if (strncmp(systemEvent.situationType, prefix.c_str(), prefix.size()) == 0)
+                        lists |= this->rules[i].lists;
+                }
+            }
+
+            if (lists != List::kNone)
+                Invalidate(lists);
+        }
+
+        /// <summary>
+        /// Invalidates every resource list when the connection to the system is restored, since notifications may
+        /// have been missed while it was lost.
+        /// </summary>
+        /// <param name="internalEvent">The internal event notification.</param>
+        void OnInternalEvent(const VxInternalEvent& internalEvent) {
+            if (internalEvent.eventType == VxInternalEventType::kSystemConnectionRestored)
+                Invalidate(List::kAll);
+        }
+
+    private:
+        struct Rule {
+            Rule(const char* situationTypePrefix, int lists) : situationTypePrefix(situationTypePrefix) {
+                this->lists = lists;
+            }
+
+            std::string situationTypePrefix;
+            int lists;
+        };
+
+        template<typename TItem>
+        struct Entry {
+            std::shared_ptr<const VxCachedCollection<TItem> > collection;
+            std::chrono::steady_clock::time_point created;
+        };
+
+        template<typename TItem>
+        struct Store {
+            Store() : generation(0) { }
+
+            void Clear() {
+                this->entries.clear();
+                this->generation++;
+            }
+
+            std::unordered_map<std::string, Entry<TItem> > entries;
+            unsigned int generation;
+        };
+
+        template<typename TItem>
+        VxResult::Value Get(Store<TItem>& store, VxResult::Value(IVxSystem::*request)(VxCollection<TItem**>&) const,
+            VxCollectionFilter* filters, int filterSize, std::shared_ptr<const VxCachedCollection<TItem> >& result) {
+            std::string key;
+            for (int i = 0; i < filterSize; i++) {
+                key += std::to_string(static_cast<int>(filters[i].key));
+                key += '=';
+                key += filters[i].value;
+                key += '\n';
+            }
+
+            unsigned int generation;
+            {
+                std::lock_guard<std::mutex> lock(this->mutex);
+                typename std::unordered_map<std::string, Entry<TItem> >::iterator it = store.entries.find(key);
+                if (it != store.entries.end()) {
+                    if (this->timeToLiveMs <= 0 || std::chrono::steady_clock::now() - it->second.created <
+                        std::chrono::milliseconds(this->timeToLiveMs)) {
+                        this->hitCount++;
+                        result = it->second.collection;
+                        return VxResult::kOK;
+                    }
+
+                    store.entries.erase(it);
+                }
+
+                this->missCount++;
+                generation = store.generation;
+            }
+
+            std::chrono::steady_clock::time_point created = std::chrono::steady_clock::now();
+            std::shared_ptr<VxCachedCollection<TItem> > collection = std::make_shared<VxCachedCollection<TItem> >();
+            VxResult::Value fetchResult = Fetch(request, filters, filterSize, collection->items);
+            if (fetchResult != VxResult::kOK)
+                return fetchResult;
+
+            result = collection;
+            std::lock_guard<std::mutex> lock(this->mutex);
+            // Do not cache a response that may predate an invalidation received while it was requested
+            if (store.generation == generation) {
+                Entry<TItem>& entry = store.entries[key];
+                entry.collection = result;
+                entry.created = created;
+            }
+
+            return VxResult::kOK;
+        }
+
+        template<typename TItem>
+        VxResult::Value Fetch(VxResult::Value(IVxSystem::*request)(VxCollection<TItem**>&) const,
+            VxCollectionFilter* filters, int filterSize, std::vector<TItem*>& items) {
+            VxCollection<TItem**> collection;
+            collection.filters = filters;
+            collection.filterSize = filterSize;
+            VxResult::Value result = (this->system->*request)(collection);
+            // Items may be added between the two requests, so retry until the collection is large enough
+            while (result == VxResult::kInsufficientSize) {
+                delete[] collection.collection;
+                collection.collection = new TItem*[collection.collectionSize];
+                result = (this->system->*request)(collection);
+            }
+
+            if (result == VxResult::kOK)
+                items.assign(collection.collection, collection.collection + collection.collectionSize);
+
+            delete[] collection.collection;
+            return result;
+        }
+
+        const IVxSystem* system;
+        int timeToLiveMs;
+        long long hitCount;
+        long long missCount;
+        std::vector<Rule> rules;
+        Store<IVxDataSource> dataSources;
+        Store<IVxDevice> devices;
+        Store<IVxSituation> situations;
+        Store<IVxTag> tags;
+        mutable std::mutex mutex;
+
+        VxResourceCache(const VxResourceCache&);
+        VxResourceCache& operator=(const VxResourceCache&);
+    };
+}
+
+#endif // VxResourceCache_h__
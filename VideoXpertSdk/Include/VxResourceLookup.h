@@ -0,0 +1,201 @@
+#ifndef VxResourceLookup_h__
+#define VxResourceLookup_h__
+
+#include "VxPrimitives.h"
+#include "VxUtilities.h"
+#include "VxMacros.h"
+#include "IVxDataSource.h"
+#include "IVxDevice.h"
+#include "IVxSystem.h"
+#include "IVxUser.h"
+#include "VxCollection.h"
+#include "VxCollectionFilter.h"
+#include <algorithm>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace VxSdk {
+    namespace Internal {
+        template<typename TItem>
+        VxResult::Value VxRequestByIds(const IVxSystem& system,
+            VxResult::Value(IVxSystem::*request)(VxCollection<TItem**>&) const, const char* const* ids, int idCount,
+            std::vector<TItem*>& found) {
+            std::vector<VxCollectionFilter> filters(idCount);
+            for (int i = 0; i < idCount; i++) {
+                filters[i].key = VxCollectionFilterItem::kId;
+                Utilities::StrCopySafe(filters[i].value, ids[i]);
+            }
+
+            VxCollection<TItem**> collection;
+            collection.filters = filters.empty() ? nullptr : &filters[0];
+            collection.filterSize = idCount;
+            collection.collectionSize = idCount;
+            collection.collection = idCount > 0 ? new TItem*[idCount] : nullptr;
+            VxResult::Value result = (system.*request)(collection);
+            while (result == VxResult::kInsufficientSize) {
+                delete[] collection.collection;
+                collection.collection = new TItem*[collection.collectionSize];
+                result = (system.*request)(collection);
+            }
+
+            if (result == VxResult::kOK)
+                found.assign(collection.collection, collection.collection + collection.collectionSize);
+
+            delete[] collection.collection;
+            collection.collection = nullptr;
+            return result;
+        }
+
+        template<typename TItem>
+        VxResult::Value VxGetByIds(const IVxSystem& system,
+            VxResult::Value(IVxSystem::*request)(VxCollection<TItem**>&) const, bool filterById,
+            const char* const* ids, int idCount, TItem** items) {
+            const int kChunkSize = 100;
+            // Positions of each requested identifier; an identifier may be requested more than once
+            std::unordered_map<std::string, std::vector<int> > positions;
+            std::vector<const char*> uniqueIds;
+            for (int i = 0; i < idCount; i++) {
+                items[i] = nullptr;
+                std::vector<int>& idPositions = positions[ids[i]];
+                if (idPositions.empty())
+                    uniqueIds.push_back(ids[i]);
+                idPositions.push_back(i);
+            }
+
+            auto take = [&](std::vector<TItem*>& found, std::unordered_set<std::string>& resolved) {
+                for (size_t i = 0; i < found.size(); i++) {
+                    std::unordered_map<std::string, std::vector<int> >::iterator it = positions.find(found[i]->id);
+                    if (it != positions.end() && !it->second.empty()) {
+                        items[it->second.back()] = found[i];
+                        it->second.pop_back();
+                        resolved.insert(it->first);
+                    }
+                    else
+                        found[i]->Delete();
+                }
+            };
+
+            VxResult::Value result = VxResult::kOK;
+            if (!filterById) {
+                std::vector<TItem*> found;
+                std::unordered_set<std::string> resolved;
+                result = VxRequestByIds(system, request, nullptr, 0, found);
+                take(found, resolved);
+            }
+
+            // A request resolves at most one position per identifier, so identifiers requested more than once are
+            // requested again in the next pass. A batch that returns more than one item shows that the system
+            // combines repeated kId filters; until then, the system may apply only one of them, so if the first
+            // batch returns fewer items, every identifier it left unresolved is requested on its own
+            size_t chunkSize = kChunkSize;
+            bool combined = false;
+            std::vector<const char*> pending;
+            if (filterById)
+                pending = uniqueIds;
+            while (!pending.empty() && result == VxResult::kOK) {
+                std::vector<const char*> next;
+                for (size_t i = 0; i < pending.size() && result == VxResult::kOK; i += chunkSize) {
+                    int size = static_cast<int>(std::min(chunkSize, pending.size() - i));
+                    std::vector<TItem*> found;
+                    std::unordered_set<std::string> resolved;
+                    result = VxRequestByIds(system, request, &pending[i], size, found);
+                    combined = combined || found.size() > 1;
+                    take(found, resolved);
+                    if (size > 1 && !combined) {
+                        chunkSize = 1;
+                        for (size_t j = i; j < pending.size(); j++) {
+                            if (!positions[pending[j]].empty())
+                                next.push_back(pending[j]);
+                        }
+
+                        break;
+                    }
+
+                    // Identifiers the request did not resolve do not exist
+                    for (int j = 0; j < size; j++) {
+                        if (resolved.count(pending[i + j]) != 0 && !positions[pending[i + j]].empty())
+                            next.push_back(pending[i + j]);
+                    }
+                }
+
+                pending.swap(next);
+            }
+
+            if (result != VxResult::kOK) {
+                for (int i = 0; i < idCount; i++) {
+                    if (items[i] != nullptr)
+                        items[i]->Delete();
+                    items[i] = nullptr;
+                }
+            }
+
+            return result;
+        }
+    }
+
+    /// <summary>
+    /// Gets the data sources with the given unique identifiers from a system.
+    /// <para>
+    /// The identifiers are sent 100 at a time as repeated kId filters, taking one request per 100 identifiers
+    /// when the system combines them. If the first batch returns fewer than two data sources, the system may apply
+    /// only one kId filter per request, and the identifiers it left unresolved are requested one at a time; the
+    /// lookup then takes at most one request more than requesting each identifier separately. An identifier that
+    /// appears more than once in <paramref name="ids"/> is requested once per occurrence.
+    /// </para>
+    /// </summary>
+    /// <param name="system">The system the data sources reside on.</param>
+    /// <param name="ids">The unique identifiers of the data sources.</param>
+    /// <param name="idCount">The size of <paramref name="ids"/>.</param>
+    /// <param name="dataSources">
+    /// An array, the size of <paramref name="ids"/>, that receives the data source for each identifier, or
+    /// <c>nullptr</c> if it does not exist. Each data source must be deleted by the caller.
+    /// </param>
+    /// <returns>The <see cref="VxResult::Value">Result</see> of the request.</returns>
+    inline VxResult::Value VxGetDataSourcesByIds(const IVxSystem& system, const char* const* ids, int idCount,
+        IVxDataSource** dataSources) {
+        return Internal::VxGetByIds(system, &IVxSystem::GetDataSources, true, ids, idCount, dataSources);
+    }
+
+    /// <summary>
+    /// Gets the devices with the given unique identifiers from a system.
+    /// <para>
+    /// The identifiers are requested the same way as by <see cref="VxGetDataSourcesByIds"/>, with the same cost:
+    /// one request per 100 identifiers when the system combines kId filters, and otherwise at most one request
+    /// more than requesting each identifier separately.
+    /// </para>
+    /// </summary>
+    /// <param name="system">The system the devices reside on.</param>
+    /// <param name="ids">The unique identifiers of the devices.</param>
+    /// <param name="idCount">The size of <paramref name="ids"/>.</param>
+    /// <param name="devices">
+    /// An array, the size of <paramref name="ids"/>, that receives the device for each identifier, or
+    /// <c>nullptr</c> if it does not exist. Each device must be deleted by the caller.
+    /// </param>
+    /// <returns>The <see cref="VxResult::Value">Result</see> of the request.</returns>
+    inline VxResult::Value VxGetDevicesByIds(const IVxSystem& system, const char* const* ids, int idCount,
+        IVxDevice** devices) {
+        return Internal::VxGetByIds(system, &IVxSystem::GetDevices, true, ids, idCount, devices);
+    }
+
+    /// <summary>
+    /// Gets the users with the given unique identifiers from a system. Users cannot be filtered by identifier, so
+    /// every user on the system is retrieved in a single request and only the requested users are kept; this is
+    /// only cheaper than separate requests when a large share of the users is requested.
+    /// </summary>
+    /// <param name="system">The system the users reside on.</param>
+    /// <param name="ids">The unique identifiers of the users.</param>
+    /// <param name="idCount">The size of <paramref name="ids"/>.</param>
+    /// <param name="users">
+    /// An array, the size of <paramref name="ids"/>, that receives the user for each identifier, or
+    /// <c>nullptr</c> if it does not exist. Each user must be deleted by the caller.
+    /// </param>
+    /// <returns>The <see cref="VxResult::Value">Result</see> of the request.</returns>
+    inline VxResult::Value VxGetUsersByIds(const IVxSystem& system, const char* const* ids, int idCount,
+        IVxUser** users) {
+        return Internal::VxGetByIds(system, &IVxSystem::GetUsers, false, ids, idCount, users);
+    }
+}
+
+#endif // VxResourceLookup_h__
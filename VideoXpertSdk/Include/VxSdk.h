@@ -5,8 +5,12 @@
 #include "VxPrimitives.h"
 #include "VxUtilities.h"
 
+#include "VxAsync.h"
+#include "VxCallbackContext.h"
 #include "VxCollection.h"
 #include "VxCollectionFilter.h"
+#include "VxCompactCollection.h"
+#include "VxCompactString.h"
 #include "VxDeviceSearch.h"
 #include "VxDiagnostics.h"
 #include "VxDiscoveryRequest.h"
@@ -69,6 +73,7 @@
 #include "VxRuleTrigger.h"
 #include "VxSmtpInfo.h"
 #include "VxSnapshotFilter.h"
+#include "VxStringPool.h"
 #include "VxTimeRange.h"
 #include "VxVector.h"
 #include "VxVideoEncodingOption.h"
@@ -135,6 +140,22 @@
 #include "IVxVolume.h"
 #include "IVxVolumeGroup.h"
 
+#include "VxCollectionPager.h"
+#include "VxCompactBookmark.h"
+#include "VxCompactClip.h"
+#include "VxCompactGap.h"
+#include "VxCoverageBitmap.h"
+#include "VxDeltaSync.h"
+#include "VxEventBatcher.h"
+#include "VxEventBulk.h"
+#include "VxEventFilter.h"
+#include "VxEventQueue.h"
+#include "VxExportDownloader.h"
+#include "VxExportStreamReader.h"
+#include "VxRecordingTimeline.h"
+#include "VxResourceCache.h"
+#include "VxResourceLookup.h"
+
 namespace VxSdk {
     /// <summary>
     /// Logs in to the VideoXpert system.
@@ -0,0 +1,323 @@
+#ifndef VxSdkCoro_h__
+#define VxSdkCoro_h__
+
+#include "VxSdk.h"
+
+// Coroutine support requires C++20; include this header only from translation units compiled with it
+#if defined(__cpp_impl_coroutine) && __cpp_impl_coroutine >= 201902L
+#include <chrono>
+#include <condition_variable>
+#include <coroutine>
+#include <exception>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+namespace VxSdk {
+    /// <summary>
+    /// A coroutine that returns a <see cref="VxResult::Value"/>. The coroutine does not start until it is awaited
+    /// by another coroutine or its result is requested using <see cref="Get"/>.
+    /// </summary>
+    struct VxCoroTask {
+    public:
+        /// <summary>
+        /// The coroutine promise type.
+        /// </summary>
+        struct promise_type {
+            promise_type() : result(VxResult::kUnknownError), isComplete(false) { }
+
+            VxCoroTask get_return_object() {
+                return VxCoroTask(std::coroutine_handle<promise_type>::from_promise(*this));
+            }
+
+            std::suspend_always initial_suspend() noexcept {
+                return std::suspend_always();
+            }
+
+            struct FinalAwaiter {
+                bool await_ready() noexcept {
+                    return false;
+                }
+
+                std::coroutine_handle<> await_suspend(std::coroutine_handle<promise_type> handle) noexcept {
+                    promise_type& promise = handle.promise();
+                    if (promise.continuation)
+                        return promise.continuation;
+
+                    // The task may be destroyed as soon as the waiting thread is notified
+                    std::lock_guard<std::mutex> lock(promise.mutex);
+                    promise.isComplete = true;
+                    promise.condition.notify_all();
+                    return std::noop_coroutine();
+                }
+
+                void await_resume() noexcept { }
+            };
+
+            FinalAwaiter final_suspend() noexcept {
+                return FinalAwaiter();
+            }
+
+            void return_value(VxResult::Value value) {
+                this->result = value;
+            }
+
+            void unhandled_exception() {
+                std::terminate();
+            }
+
+            VxResult::Value result;
+            std::coroutine_handle<> continuation;
+            bool isComplete;
+            std::mutex mutex;
+            std::condition_variable condition;
+        };
+
+        /// <summary>
+        /// Initializes a new instance of the <see cref="VxCoroTask"/> struct.
+        /// </summary>
+        /// <param name="ref">The task to take ownership of.</param>
+        VxCoroTask(VxCoroTask&& ref) noexcept : handle(std::exchange(ref.handle, nullptr)) { }
+
+        /// <summary>
+        /// Finalizes an instance of the <see cref="VxCoroTask"/> class.
+        /// </summary>
+        ~VxCoroTask() {
+            if (this->handle)
+                this->handle.destroy();
+        }
+
+        /// <summary>
+        /// Runs the coroutine and blocks until it has completed. Must not be called from a coroutine.
+        /// </summary>
+        /// <returns>The <see cref="VxResult::Value">Result</see> of the coroutine.</returns>
+        VxResult::Value Get() {
+            promise_type& promise = this->handle.promise();
+            this->handle.resume();
+            std::unique_lock<std::mutex> lock(promise.mutex);
+            promise.condition.wait(lock, [&promise] { return promise.isComplete; });
+            return promise.result;
+        }
+
+        bool await_ready() const noexcept {
+            return false;
+        }
+
+        std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaiting) noexcept {
+            this->handle.promise().continuation = awaiting;
+            return this->handle;
+        }
+
+        VxResult::Value await_resume() noexcept {
+            return this->handle.promise().result;
+        }
+
+    private:
+        explicit VxCoroTask(std::coroutine_handle<promise_type> handle) : handle(handle) { }
+
+        std::coroutine_handle<promise_type> handle;
+
+        VxCoroTask(const VxCoroTask&);
+        VxCoroTask& operator=(const VxCoroTask&);
+    };
+
+    /// <summary>
+    /// Awaits a request run on a <see cref="VxAsyncExecutor"/>; see <see cref="VxCallAsync"/>. The awaiting
+    /// coroutine is resumed on the executor thread that ran the request.
+    /// </summary>
+    template<typename TFunction>
+    struct VxCoroCall {
+    public:
+        /// <summary>
+        /// Initializes a new instance of the <see cref="VxCoroCall{TFunction}"/> struct.
+        /// </summary>
+        /// <param name="executor">The executor to run the request on.</param>
+        /// <param name="function">The request.</param>
+        VxCoroCall(VxAsyncExecutor& executor, TFunction function) : function(std::move(function)) {
+            this->executor = &executor;
+            this->result = VxResult::kUnknownError;
+        }
+
+        bool await_ready() const noexcept {
+            return false;
+        }
+
+        void await_suspend(std::coroutine_handle<> awaiting) {
+            this->awaiting = awaiting;
+            this->executor->RunWithCallback(&VxCoroCall::Resume, this, std::move(this->function));
+        }
+
+        VxResult::Value await_resume() const noexcept {
+            return this->result;
+        }
+
+    private:
+        static void Resume(VxResult::Value result, void* userData) {
+            VxCoroCall* call = static_cast<VxCoroCall*>(userData);
+            call->result = result;
+            call->awaiting.resume();
+        }
+
+        VxAsyncExecutor* executor;
+        TFunction function;
+        VxResult::Value result;
+        std::coroutine_handle<> awaiting;
+    };
+
+    /// <summary>
+    /// Awaits a method of an SDK object run on a <see cref="VxAsyncExecutor"/>, e.g.
+    /// <c>co_await VxCallAsync(executor, system, &amp;IVxSystem::GetDataSources, std::ref(collection))</c>.
+    /// Arguments are copied; wrap output arguments in <c>std::ref</c>.
+    /// </summary>
+    /// <param name="executor">The executor to run the request on.</param>
+    /// <param name="object">The object to call <paramref name="method"/> on.</param>
+    /// <param name="method">The method to call.</param>
+    /// <param name="args">The arguments to pass to <paramref name="method"/>.</param>
+    /// <returns>An awaitable for the <see cref="VxResult::Value">Result</see> of the request.</returns>
+    template<typename TObject, typename TMethod, typename... TArgs>
+    auto VxCallAsync(VxAsyncExecutor& executor, TObject* object, TMethod method, TArgs&&... args) {
+        auto function = std::bind(method, object, std::forward<TArgs>(args)...);
+        return VxCoroCall<decltype(function)>(executor, std::move(function));
+    }
+
+    namespace Internal {
+        struct VxCoroTimer {
+            VxCoroTimer() : exiting(false), worker(&VxCoroTimer::Run, this) { }
+
+            ~VxCoroTimer() {
+                {
+                    std::lock_guard<std::mutex> lock(this->mutex);
+                    this->exiting = true;
+                }
+                this->condition.notify_one();
+                this->worker.join();
+            }
+
+            static VxCoroTimer& Instance() {
+                static VxCoroTimer timer;
+                return timer;
+            }
+
+            void Schedule(std::chrono::steady_clock::time_point due, std::function<void()> action) {
+                {
+                    std::lock_guard<std::mutex> lock(this->mutex);
+                    this->pending.insert(std::make_pair(due, std::move(action)));
+                }
+                this->condition.notify_one();
+            }
+
+            void Run() {
+                std::unique_lock<std::mutex> lock(this->mutex);
+                while (!this->exiting) {
+                    if (this->pending.empty()) {
+                        this->condition.wait(lock);
+                        continue;
+                    }
+
+                    if (this->condition.wait_until(lock, this->pending.begin()->first) == std::cv_status::timeout &&
+                        !this->pending.empty() && this->pending.begin()->first <= std::chrono::steady_clock::now()) {
+                        std::function<void()> action = std::move(this->pending.begin()->second);
+                        this->pending.erase(this->pending.begin());
+                        lock.unlock();
+                        action();
+                        lock.lock();
+                    }
+                }
+            }
+
+            bool exiting;
+            std::multimap<std::chrono::steady_clock::time_point, std::function<void()> > pending;
+            std::mutex mutex;
+            std::condition_variable condition;
+            std::thread worker;
+        };
+    }
+
+    /// <summary>
+    /// Awaits a delay without blocking a thread; the awaiting coroutine is resumed on a
+    /// <see cref="VxAsyncExecutor"/> thread.
+    /// </summary>
+    struct VxCoroDelay {
+    public:
+        /// <summary>
+        /// Initializes a new instance of the <see cref="VxCoroDelay"/> struct.
+        /// </summary>
+        /// <param name="executor">The executor to resume the awaiting coroutine on.</param>
+        /// <param name="delayMs">The delay, in milliseconds.</param>
+        VxCoroDelay(VxAsyncExecutor& executor, int delayMs) {
+            this->executor = &executor;
+            this->delayMs = delayMs;
+        }
+
+        bool await_ready() const noexcept {
+            return this->delayMs <= 0;
+        }
+
+        void await_suspend(std::coroutine_handle<> awaiting) {
+            VxAsyncExecutor* executor = this->executor;
+            Internal::VxCoroTimer::Instance().Schedule(
+                std::chrono::steady_clock::now() + std::chrono::milliseconds(this->delayMs), [executor, awaiting]() {
+                    executor->RunWithCallback(nullptr, nullptr, [awaiting]() {
+                        awaiting.resume();
+                        return VxResult::kOK;
+                    });
+                });
+        }
+
+        void await_resume() const noexcept { }
+
+    private:
+        VxAsyncExecutor* executor;
+        int delayMs;
+    };
+
+    /// <summary>
+    /// Waits for an export to finish by refreshing it periodically, without blocking a thread between refreshes.
+    /// </summary>
+    /// <param name="executor">The executor to run the refresh requests on.</param>
+    /// <param name="exportItem">The export to wait for; its members reflect the final state on completion.</param>
+    /// <param name="pollIntervalMs">The interval between refreshes, in milliseconds.</param>
+    /// <returns>
+    /// A task for the <see cref="VxResult::Value">Result</see>: kOK once the export is successful, the failure
+    /// reason (e.g. kExportStorageFull) if it failed, kUnknownError if its status is unknown, or the result of a
+    /// failed refresh.
+    /// </returns>
+    inline VxCoroTask VxWaitUntilComplete(VxAsyncExecutor& executor, IVxExport& exportItem,
+        int pollIntervalMs = 1000) {
+        while (true) {
+            VxResult::Value result = co_await VxCallAsync(executor, &exportItem, &IVxExport::Refresh);
+            if (result != VxResult::kOK)
+                co_return result;
+
+            if (exportItem.status == VxExportStatus::kSuccessful)
+                co_return VxResult::kOK;
+
+            // An unknown status will not resolve by refreshing again, so it would otherwise be polled forever
+            if (exportItem.status == VxExportStatus::kUnknown)
+                co_return VxResult::kUnknownError;
+
+            if (exportItem.status == VxExportStatus::kFailed) {
+                switch (exportItem.statusReason) {
+                case VxExportStatusReason::kExportDataUnretrievable:
+                    co_return VxResult::kExportDataUnretrievable;
+                case VxExportStatusReason::kExportStorageFull:
+                    co_return VxResult::kExportStorageFull;
+                case VxExportStatusReason::kExportStorageUnauthenticated:
+                    co_return VxResult::kExportStorageUnauthenticated;
+                case VxExportStatusReason::kExportStorageUnavailable:
+                    co_return VxResult::kExportStorageUnavailable;
+                default:
+                    co_return VxResult::kOperationFailed;
+                }
+            }
+
+            co_await VxCoroDelay(executor, pollIntervalMs);
+        }
+    }
+}
+
+#endif // __cpp_impl_coroutine
+
+#endif // VxSdkCoro_h__
@@ -0,0 +1,64 @@
+#ifndef VxStringPool_h__
+#define VxStringPool_h__
+
+#include "VxPrimitives.h"
+#include "VxUtilities.h"
+#include "VxMacros.h"
+#include <string>
+#include <unordered_set>
+
+namespace VxSdk {
+    /// <summary>
+    /// Stores a single copy of each distinct string added to it. The returned pointers remain valid until the pool
+    /// is cleared or destroyed.
+    /// </summary>
+    struct VxStringPool {
+    public:
+        /// <summary>
+        /// Initializes a new instance of the <see cref="VxStringPool"/> struct.
+        /// </summary>
+        VxStringPool() {
+            Clear();
+        }
+
+        /// <summary>
+        /// Finalizes an instance of the <see cref="VxStringPool"/> class.
+        /// </summary>
+        ~VxStringPool() {
+            Clear();
+        }
+
+        /// <summary>
+        /// Clears this instance, invalidating all previously interned strings.
+        /// </summary>
+        void Clear() {
+            this->strings.clear();
+        }
+
+        /// <summary>
+        /// Gets the pooled copy of a string, adding it to the pool if it is not already present.
+        /// </summary>
+        /// <param name="value">The string to intern; <c>nullptr</c> is treated as an empty string.</param>
+        /// <returns>The pooled copy of <paramref name="value"/>.</returns>
+        const char* Intern(const char* value) {
+            return this->strings.insert(value != nullptr ? value : "").first->c_str();
+        }
+
+        /// <summary>
+        /// Gets the number of distinct strings in the pool.
+        /// </summary>
+        /// <returns>The number of distinct strings.</returns>
+        int Size() const {
+            return static_cast<int>(this->strings.size());
+        }
+
+    private:
+        VxStringPool(const VxStringPool&);
+        VxStringPool& operator=(const VxStringPool&);
+
+        // Node based, so element addresses are stable across rehashing
+        std::unordered_set<std::string> strings;
+    };
+}
+
+#endif // VxStringPool_h__
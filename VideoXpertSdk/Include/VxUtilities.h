@@ -31,6 +31,128 @@ namespace VxSdk {
                 dst[dstSize - 1] = 0;
             }
         }
+
+        /// <summary>
+        /// Formats a number of milliseconds since the Unix epoch as an ISO 8601 UTC date and time, such as those
+        /// accepted by the VideoXpert system, e.g. <c>2020-06-01T12:30:00.250Z</c>.
+        /// </summary>
+        /// <param name="milliseconds">The time, in milliseconds since the Unix epoch.</param>
+        /// <param name="time">The formatted time.</param>
+        inline void FormatIsoTime(long long milliseconds, char time[64]) {
+            long long seconds = milliseconds / 1000;
+            int fraction = static_cast<int>(milliseconds % 1000);
+            if (fraction < 0) {
+                fraction += 1000;
+                seconds--;
+            }
+
+            long long days = seconds / 86400;
+            int secondOfDay = static_cast<int>(seconds % 86400);
+            if (secondOfDay < 0) {
+                secondOfDay += 86400;
+                days--;
+            }
+
+            // Converts days since the epoch to a proleptic Gregorian date, counting years from March
+            long long shifted = days + 719468;
+            long long era = (shifted >= 0 ? shifted : shifted - 146096) / 146097;
+            int dayOfEra = static_cast<int>(shifted - era * 146097);
+            int yearOfEra = (dayOfEra - dayOfEra / 1460 + dayOfEra / 36524 - dayOfEra / 146096) / 365;
+            int dayOfYear = dayOfEra - (365 * yearOfEra + yearOfEra / 4 - yearOfEra / 100);
+            int monthIndex = (5 * dayOfYear + 2) / 153;
+            int day = dayOfYear - (153 * monthIndex + 2) / 5 + 1;
+            int month = monthIndex < 10 ? monthIndex + 3 : monthIndex - 9;
+            int year = static_cast<int>(yearOfEra + era * 400) + (month <= 2 ? 1 : 0);
+
+            const int values[7] = { year, month, day, secondOfDay / 3600, secondOfDay / 60 % 60, secondOfDay % 60,
+                fraction };
+            const int widths[7] = { 4, 2, 2, 2, 2, 2, 3 };
+            const char separators[7] = { '-', '-', 'T', ':', ':', '.', 'Z' };
+            char* p = time;
+            for (int i = 0; i < 7; i++) {
+                int value = values[i];
+                for (int j = widths[i] - 1; j >= 0; j--, value /= 10)
+                    p[j] = static_cast<char>('0' + value % 10);
+                p += widths[i];
+                *p++ = separators[i];
+            }
+            *p = '\0';
+        }
+
+        /// <summary>
+        /// Parses an ISO 8601 date and time, such as those returned by the VideoXpert system, into the number of
+        /// milliseconds since the Unix epoch (UTC). Fractional seconds beyond milliseconds are truncated; a time
+        /// without a zone designator is treated as UTC.
+        /// </summary>
+        /// <param name="time">The time to parse, e.g. <c>2020-06-01T12:30:00.250Z</c>.</param>
+        /// <param name="milliseconds">The parsed time, in milliseconds since the Unix epoch.</param>
+        /// <returns><c>true</c> if <paramref name="time"/> was parsed, otherwise <c>false</c>.</returns>
+        inline bool ParseIsoTime(const char* time, long long& milliseconds) {
+            if (time == nullptr)
+                return false;
+
+            // Fields in order: year, month, day, hour, minute, second, with the separator preceding each
+            const int widths[6] = { 4, 2, 2, 2, 2, 2 };
+            const char separators[6] = { 0, '-', '-', 'T', ':', ':' };
+            int fields[6];
+            const char* p = time;
+            for (int i = 0; i < 6; i++) {
+                if (separators[i] != 0 && *p++ != separators[i] && !(i == 3 && p[-1] == ' '))
+                    return false;
+
+                fields[i] = 0;
+                for (int j = 0; j < widths[i]; j++, p++) {
+                    if (*p < '0' || *p > '9')
+                        return false;
+                    fields[i] = fields[i] * 10 + (*p - '0');
+                }
+            }
+
+            int fraction = 0;
+            if (*p == '.' || *p == ',') {
+                int scale = 100;
+                for (p++; *p >= '0' && *p <= '9'; p++, scale /= 10)
+                    fraction += (*p - '0') * scale;
+            }
+
+            int offsetMinutes = 0;
+            if (*p == '+' || *p == '-') {
+                int sign = *p++ == '-' ? -1 : 1;
+                int digits[4];
+                int count = 0;
+                for (; count < 4 && *p != '\0'; p++) {
+                    if (*p == ':')
+                        continue;
+                    if (*p < '0' || *p > '9')
+                        return false;
+                    digits[count++] = *p - '0';
+                }
+
+                if (count != 2 && count != 4)
+                    return false;
+                int hours = digits[0] * 10 + digits[1];
+                int minutes = count == 4 ? digits[2] * 10 + digits[3] : 0;
+                offsetMinutes = sign * (hours * 60 + minutes);
+            }
+            else if (*p == 'Z' || *p == 'z')
+                p++;
+
+            if (*p != '\0' || fields[1] < 1 || fields[1] > 12 || fields[2] < 1 || fields[2] > 31 || fields[3] > 23 ||
+                fields[4] > 59 || fields[5] > 60)
+                return false;
+
+            // Days since the epoch of the proleptic Gregorian date, counting years from March
+            int year = fields[0] - (fields[1] <= 2 ? 1 : 0);
+            int era = year / 400;
+            int yearOfEra = year - era * 400;
+            int dayOfYear = (153 * (fields[1] + (fields[1] > 2 ? -3 : 9)) + 2) / 5 + fields[2] - 1;
+            int dayOfEra = yearOfEra * 365 + yearOfEra / 4 - yearOfEra / 100 + dayOfYear;
+            long long days = static_cast<long long>(era) * 146097 + dayOfEra - 719468;
+
+            long long seconds = days * 86400 + fields[3] * 3600 + fields[4] * 60 + fields[5] - offsetMinutes * 60;
+            milliseconds = seconds * 1000 + fraction;
+            return true;
+        }
     }
 }
 